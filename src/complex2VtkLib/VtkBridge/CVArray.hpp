@@ -1,33 +1,125 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <typeinfo>
+#include <vector>
 
 #include "vtkGenericDataArray.h"
+#include "vtkIdList.h"
+#include "vtkLookupTable.h"
+#include "vtkSMPTools.h"
 #include "vtkSetGet.h"
 
+#include "complex/DataStructure/AbstractDataStore.hpp"
 #include "complex/DataStructure/DataArray.hpp"
 #include "complex/DataStructure/DataStore.hpp"
 
+#include "complex2VtkLib/VtkBridge/CVArrayPool.hpp"
+#include "complex2VtkLib/VtkBridge/CVArrayRange.hpp"
+#include "complex2VtkLib/VtkBridge/CVChunkedValueReader.hpp"
+#include "complex2VtkLib/VtkBridge/CVDirtyTupleRanges.hpp"
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+#include "complex2VtkLib/VtkBridge/CVPooledDataStore.hpp"
+#include "complex2VtkLib/VtkBridge/CVRunLengthDataStore.hpp"
 #include "complex2VtkLib/complex2VtkLib_export.hpp"
 
 namespace CV
 {
+/**
+ * @brief Component count template argument for CV::Array instances whose number
+ * of components is only known at runtime.
+ */
+inline constexpr int k_DynamicComponents = -1;
+
+/**
+ * @brief Process-wide counters for the staging path of CV::Array::GetVoidPointer().
+ * Staging copies a whole non-contiguous store, so these should stay close to zero in
+ * a well behaved pipeline.
+ */
+struct StagingCounters
+{
+  /** @brief Number of times a non-contiguous store was copied into a staging buffer. */
+  static inline std::atomic<uint64_t> Materializations{0};
+  /** @brief Total number of bytes copied into staging buffers. */
+  static inline std::atomic<uint64_t> MaterializedBytes{0};
+  /** @brief Number of times a staging buffer was written back to its store. */
+  static inline std::atomic<uint64_t> WriteBacks{0};
+  /** @brief Total number of bytes written back from staging buffers. */
+  static inline std::atomic<uint64_t> WrittenBackBytes{0};
+
+  /**
+   * @brief Resets all counters to zero.
+   */
+  static void Reset()
+  {
+    Materializations = 0;
+    MaterializedBytes = 0;
+    WriteBacks = 0;
+    WrittenBackBytes = 0;
+  }
+};
+
 /**
  * @class CV::Array
  * @brief The CVArray class serves as a wrapper around a complex DataArray to
  * make it available for use in VTK without duplicating the underlying data.
+ *
+ * When the DataArray is backed by a contiguous complex::DataStore<T> or a memory
+ * mapped CV::MappedDataStore<T>, the raw data pointer is cached and all element
+ * access is done through plain pointer arithmetic. Run-length encoded
+ * CV::RunLengthDataStore<T> stores are read through their per-thread block cache.
+ * Chunked stores such as CV::Hdf5ChunkedDataStore<T> are found through the
+ * CV::ChunkedValueReader<T> interface and copy value ranges chunk by chunk.
+ * Other store types fall back to the virtual AbstractDataStore API.
+ *
+ * Callers that need a raw pointer into a non-contiguous store get one from
+ * GetVoidPointer() through staging: the values are copied into a contiguous buffer
+ * that then serves all element access. Only the staged tuples that were written are
+ * copied back to the store, by DataChanged() and ReleaseStagedValues(). The buffer is
+ * kept until ReleaseStagedValues(), SetComplexArray(), a reallocation or the destructor.
+ * While staged, complex sees VTK's writes only after the next write back, and complex
+ * code must not write to the store. See GetVoidPointer() and CV::StagingCounters.
+ *
+ * Optionally, the tuples written through this array are recorded in a
+ * CV::DirtyTupleRanges tracker so that complex code can save or recompute only the
+ * changed region. See SetDirtyTracking().
+ *
+ * NewInstance(), which VTK filters use to create their output and temporary arrays,
+ * follows the bridge-wide CV::NewInstancePolicy. By default it returns a
+ * CV::Array<T> over a new complex::DataArray, so filter outputs stay backed by
+ * complex data. NewInstancePolicy::VtkArray opts into plain VTK arrays.
+ *
+ * Scalar and vector ranges are computed in parallel and cached until the array's
+ * modification time changes.
+ *
+ * If NumComps is positive, the number of components is fixed at compile time so
+ * that tuple and component loops can be unrolled and vectorized by the compiler.
  * @tparam T
+ * @tparam NumComps Compile-time number of components or k_DynamicComponents
  */
-template <class T>
-class Array : public vtkGenericDataArray<CV::Array<T>, T>
+template <class T, int NumComps = k_DynamicComponents>
+class Array : public vtkGenericDataArray<CV::Array<T, NumComps>, T>
 {
 public:
+  using SelfType = CV::Array<T, NumComps>;
   using ComplexArrayType = complex::DataArray<T>;
   using ComplexArrayPointerType = std::shared_ptr<ComplexArrayType>;
   using ValueType = T;
-  using Superclass2 = vtkGenericDataArray<CV::Array<T>, T>;
+  using Superclass2 = vtkGenericDataArray<SelfType, T>;
+
+  // The class name comes from typeid() so that SafeDownCast distinguishes between the
+  // different instantiations of CV::Array. NewInstance() does not return SelfType, as
+  // fixed component instantiations create CV::Array<T, k_DynamicComponents> instances,
+  // so the typed NewInstance() returns a vtkDataArray.
+  vtkAbstractTypeMacroWithNewInstanceType(SelfType, Superclass2, vtkDataArray, typeid(SelfType).name());
 
-  vtkAbstractTypeMacro(CV::Array<T>, Superclass2);
+  static constexpr int k_NumComponents = NumComps;
+  static constexpr bool k_HasFixedComponents = NumComps > 0;
 
   static inline const std::string MissingArrayName = "[Missing Array]";
 
@@ -35,9 +127,9 @@ public:
    * @brief Creates a new instance of CV::Array. This is required of vtkObject derived classes
    * @return
    */
-  static CV::Array<T>* New()
+  static SelfType* New()
   {
-    return new CV::Array<T>();
+    return new SelfType();
   }
 
   /**
@@ -66,14 +158,20 @@ public:
   Array& operator=(const Array&) = delete;
   Array& operator=(Array&&) noexcept = delete;
 
-  virtual ~Array() = default;
+  virtual ~Array()
+  {
+    flushStagedValues();
+    SetDirtyTracking(false);
+  }
 
   /**
-   * @brief
+   * @brief Replaces the wrapped DataArray. Staged values are written back to the
+   * previous DataArray first.
    * @param dataArray
    */
   void SetComplexArray(const ComplexArrayPointerType& dataArray)
   {
+    flushStagedValues();
     m_DataArray = dataArray;
     if(dataArray == nullptr)
     {
@@ -81,11 +179,159 @@ public:
     }
     else
     {
+      if constexpr(k_HasFixedComponents)
+      {
+        if(dataArray->getNumberOfComponents() != k_NumComponents)
+        {
+          throw std::runtime_error("CV::Array::SetComplexArray() complex::DataArray component count does not match the compile-time component count");
+        }
+      }
       SetName(dataArray->getName().c_str());
       this->NumberOfComponents = m_DataArray->getNumberOfComponents();
       this->Size = m_DataArray->getNumberOfTuples() * this->NumberOfComponents;
       this->MaxId = this->Size - 1;
     }
+    updateStorageCache();
+  }
+
+  /**
+   * @brief Returns the wrapped complex::DataArray. Allocating or growing the array
+   * through VTK replaces it with a new DataArray.
+   * @return ComplexArrayPointerType
+   */
+  ComplexArrayPointerType GetComplexArray() const
+  {
+    return m_DataArray;
+  }
+
+  /**
+   * @brief Returns true if element access goes directly through a cached pointer
+   * into a contiguous complex::DataStore<T> or a staging buffer.
+   * @return bool
+   */
+  bool HasContiguousStorage() const
+  {
+    return m_RawData != nullptr;
+  }
+
+  /**
+   * @brief Enables or disables staging of non-contiguous stores in GetVoidPointer().
+   * Staging is enabled by default. When disabled, GetVoidPointer() returns nullptr for
+   * non-contiguous stores.
+   * @param enabled
+   */
+  void SetStagingEnabled(bool enabled)
+  {
+    m_StagingEnabled = enabled;
+  }
+
+  /**
+   * @brief Returns true if GetVoidPointer() may stage non-contiguous stores.
+   * @return bool
+   */
+  bool GetStagingEnabled() const
+  {
+    return m_StagingEnabled;
+  }
+
+  /**
+   * @brief Returns true if element access currently goes through a staging buffer.
+   * @return bool
+   */
+  bool IsStaged() const
+  {
+    return m_Staged;
+  }
+
+  /**
+   * @brief Returns the number of staged tuples waiting to be written back to the store.
+   * @return size_t
+   */
+  size_t GetNumberOfStagedDirtyTuples() const
+  {
+    return m_StagedTuples == nullptr ? 0 : m_StagedTuples->getNumberOfDirtyTuples();
+  }
+
+  /**
+   * @brief Returns the number of times this array staged its store.
+   * @return uint64_t
+   */
+  uint64_t GetNumberOfMaterializations() const
+  {
+    return m_NumberOfMaterializations;
+  }
+
+  /**
+   * @brief Returns the number of times this array wrote its staging buffer back.
+   * @return uint64_t
+   */
+  uint64_t GetNumberOfWriteBacks() const
+  {
+    return m_NumberOfWriteBacks;
+  }
+
+  /**
+   * @brief Enables or disables recording of the tuples written through this array.
+   * While enabled, the tracker is registered for the wrapped complex::DataArray and can
+   * be found with CV::DirtyTupleRanges::Find(). Writes through the pointer returned by
+   * GetVoidPointer() cannot be seen, so an external DataChanged() call marks the whole
+   * array as dirty.
+   * @param enabled
+   * @param blockShift log2 of the number of tuples per tracked block
+   */
+  void SetDirtyTracking(bool enabled, int blockShift = CV::DirtyTupleRanges::k_DefaultBlockShift)
+  {
+    if(m_TrackedArray != nullptr)
+    {
+      CV::DirtyTupleRanges::Unregister(*m_TrackedArray, m_DirtyTracker);
+      m_TrackedArray = nullptr;
+    }
+    m_DirtyRanges.reset();
+    m_DirtyTracker = nullptr;
+    if(enabled)
+    {
+      m_DirtyRanges = std::make_shared<CV::DirtyTupleRanges>(0, blockShift);
+      m_DirtyTracker = m_DirtyRanges.get();
+      updateDirtyTracking();
+    }
+  }
+
+  /**
+   * @brief Returns the dirty tuple tracker or nullptr if tracking is disabled.
+   * @return std::shared_ptr<CV::DirtyTupleRanges>
+   */
+  std::shared_ptr<CV::DirtyTupleRanges> GetDirtyRanges() const
+  {
+    return m_DirtyRanges;
+  }
+
+  /**
+   * @brief Marks the tuples [begin, end) as dirty, e.g. after writing through the
+   * pointer returned by GetVoidPointer(). For a staged array this also tells the next
+   * write back exactly which tuples were written through that pointer.
+   * @param begin
+   * @param end
+   */
+  void MarkTuplesDirty(vtkIdType begin, vtkIdType end)
+  {
+    markDirty(begin, end);
+    m_UnreportedPointerWrites = false;
+  }
+
+  /**
+   * @brief Writes the dirty part of the staging buffer back to the store and releases
+   * the buffer. Element access goes through the store again afterwards, so pointers
+   * previously returned by GetVoidPointer() must no longer be used. Call this before
+   * complex code reads or writes the store of a staged array.
+   */
+  void ReleaseStagedValues()
+  {
+    if(!m_Staged)
+    {
+      return;
+    }
+    flushStagedValues();
+    updateStorageCache();
   }
 
   /**
@@ -102,6 +348,23 @@ public:
     m_DataArray->rename(name);
   }
 
+  /**
+   * @brief Rejects component counts that differ from the compile-time component count.
+   * @param numComps
+   */
+  void SetNumberOfComponents(int numComps) override
+  {
+    if constexpr(k_HasFixedComponents)
+    {
+      if(numComps != k_NumComponents)
+      {
+        vtkErrorMacro("CV::Array has a fixed number of components (" << k_NumComponents << "). Cannot set " << numComps << " components.");
+        return;
+      }
+    }
+    Superclass::SetNumberOfComponents(numComps);
+  }
+
   /**
    * @brief Get the value at valueIdx.
    *
@@ -113,11 +376,15 @@ public:
    */
   inline ValueType GetValue(vtkIdType valueIdx) const
   {
-    if(nullptr == m_DataArray)
+    if(nullptr != m_RawData)
+    {
+      return m_RawData[valueIdx];
+    }
+    if(nullptr == m_DataStore)
     {
       throw std::runtime_error("CV::Array::GetValue() does not have an underlying complex::DataArray");
     }
-    return (*m_DataArray)[valueIdx];
+    return readValue(valueIdx);
   }
 
   /**
@@ -130,11 +397,17 @@ public:
    */
   inline void SetValue(vtkIdType valueIdx, ValueType value)
   {
-    if(nullptr == m_DataArray)
+    markDirty(valueIdx / getNumComponents());
+    if(nullptr != m_RawData)
+    {
+      m_RawData[valueIdx] = value;
+      return;
+    }
+    if(nullptr == m_DataStore)
     {
       throw std::runtime_error("CV::Array::SetValue() does not have an underlying complex::DataArray");
     }
-    (*m_DataArray)[valueIdx] = value;
+    m_DataStore->setValue(valueIdx, value);
   }
 
   /**
@@ -147,16 +420,24 @@ public:
    */
   inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
   {
-    if(nullptr == m_DataArray)
+    const int numComps = getNumComponents();
+    const vtkIdType elementIndex = tupleIdx * numComps;
+    if(nullptr != m_RawData)
+    {
+      const ValueType* source = m_RawData + elementIndex;
+      for(int i = 0; i < numComps; i++)
+      {
+        tuple[i] = source[i];
+      }
+      return;
+    }
+    if(nullptr == m_DataStore)
     {
       throw std::runtime_error("CV::Array::GetTypedTuple() does not have an underlying complex::DataArray");
     }
-    auto dataStore = m_DataArray->getDataStore();
-    const size_t numComps = dataStore->getNumberOfComponents();
-    const size_t elementIndex = tupleIdx * numComps;
-    for(size_t i = 0; i < numComps; i++)
+    for(int i = 0; i < numComps; i++)
     {
-      tuple[i] = (*dataStore)[elementIndex + i];
+      tuple[i] = readValue(elementIndex + i);
     }
   }
 
@@ -171,16 +452,25 @@ public:
    */
   inline void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
   {
-    if(nullptr == m_DataArray)
+    markDirty(tupleIdx);
+    const int numComps = getNumComponents();
+    const vtkIdType elementIndex = tupleIdx * numComps;
+    if(nullptr != m_RawData)
+    {
+      ValueType* destination = m_RawData + elementIndex;
+      for(int i = 0; i < numComps; i++)
+      {
+        destination[i] = tuple[i];
+      }
+      return;
+    }
+    if(nullptr == m_DataStore)
     {
       throw std::runtime_error("CV::Array::SetTypedTuple() does not have an underlying complex::DataArray");
     }
-    auto dataStore = m_DataArray->getDataStore();
-    const size_t numComps = dataStore->getNumberOfComponents();
-    const size_t elementIndex = tupleIdx * numComps;
-    for(size_t i = 0; i < numComps; i++)
+    for(int i = 0; i < numComps; i++)
     {
-      (*dataStore)[elementIndex + i] = tuple[i];
+      m_DataStore->setValue(elementIndex + i, tuple[i]);
     }
   }
 
@@ -192,14 +482,16 @@ public:
    */
   inline ValueType GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
   {
-    if(nullptr == m_DataArray)
+    const auto elementIndex = tupleIdx * getNumComponents() + compIdx;
+    if(nullptr != m_RawData)
+    {
+      return m_RawData[elementIndex];
+    }
+    if(nullptr == m_DataStore)
     {
       throw std::runtime_error("CV::Array::GetTypedComponent() does not have an underlying complex::DataArray");
     }
-    const auto elementIndex = tupleIdx * this->NumberOfComponents;
-    ValueType value = (*m_DataArray)[elementIndex + compIdx];
-    //   std::cout << " * GetTypedComponent() " << tupleIdx << ":" << compIdx  << " = " << value << std::endl;
-    return value;
+    return readValue(elementIndex);
   }
 
   /**
@@ -210,12 +502,18 @@ public:
    */
   inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, ValueType value)
   {
-    if(nullptr == m_DataArray)
+    markDirty(tupleIdx);
+    const auto elementIndex = tupleIdx * getNumComponents() + compIdx;
+    if(nullptr != m_RawData)
+    {
+      m_RawData[elementIndex] = value;
+      return;
+    }
+    if(nullptr == m_DataStore)
     {
       throw std::runtime_error("CV::Array::SetTypedComponent() does not have an underlying complex::DataArray");
     }
-    const auto elementIndex = tupleIdx * this->NumberOfComponents;
-    (*m_DataArray)[elementIndex + compIdx] = value;
+    m_DataStore->setValue(elementIndex, value);
   }
 
   /**
@@ -233,13 +531,17 @@ public:
     }
 
     // If there is no difference in size, then just return true
-    if(m_DataArray->getNumberOfTuples() == numTuples)
+    if(m_DataArray->getNumberOfTuples() == numTuples && m_DataArray->getNumberOfComponents() == this->NumberOfComponents)
     {
       return true;
     }
 
-    // Now swap the vtkDataArrays
-    m_DataArray = createNewDataArray(numTuples);
+    // Pooled stores are resized in place, otherwise swap the vtkDataArrays
+    if(!reshapePooledStore(numTuples))
+    {
+      m_DataArray = createNewDataArray(numTuples);
+    }
+    updateStorageCache();
 
     // Now update the vtkGenericDataArray internal values
     this->NumberOfComponents = m_DataArray->getNumberOfComponents();
@@ -252,6 +554,14 @@ public:
   /**
    * @brief Allocates space for a given number of tuples.  Old data *WILL* be preserved.
    * If numTuples == 0, all data is freed.
+   *
+   * numTuples is the new capacity. vtkGenericDataArray::Resize grows the capacity
+   * geometrically and tracks the logical size in MaxId, so repeated InsertNextTuple
+   * calls are amortized O(1). The values are moved into a CV::PooledDataStore whose
+   * buffer holds the full capacity while the complex::DataArray keeps reporting the
+   * logical number of tuples. Later growth only reallocates once the capacity is
+   * exceeded. See syncComplexTupleCount() for when appended tuples become visible to
+   * complex.
    * @param numTuples
    * @return bool
    */
@@ -262,58 +572,944 @@ public:
       throw std::runtime_error("CV::Array::ReallocateTuples() does not have an underlying complex::DataArray");
     }
 
+    const size_t capacity = static_cast<size_t>(numTuples) * getNumComponents();
+    const size_t numLogicalTuples = std::min(static_cast<size_t>(this->GetNumberOfTuples()), static_cast<size_t>(numTuples));
+
+    // Pooled stores keep their values when their capacity grows in place. Shrinking,
+    // e.g. by Squeeze(), moves the values into a smaller buffer below.
+    auto* pooledStore = dynamic_cast<CV::PooledDataStore<T>*>(m_DataStore);
+    if(nullptr != pooledStore && pooledStore->getNumberOfComponents() == static_cast<size_t>(this->NumberOfComponents) && capacity >= pooledStore->getCapacity())
+    {
+      pooledStore->reserveValues(capacity);
+      pooledStore->reshapeTuples({numLogicalTuples});
+      updateStorageCache();
+      this->Size = static_cast<vtkIdType>(capacity);
+      return true;
+    }
+
     // Now swap the vtkDataArrays
-    ComplexArrayPointerType copyOfDataArrayPtr = createNewDataArray(numTuples);
+    ComplexArrayPointerType copyOfDataArrayPtr = createNewDataArray(static_cast<vtkIdType>(numLogicalTuples), true);
+    auto* newStore = dynamic_cast<CV::PooledDataStore<T>*>(copyOfDataArrayPtr->getDataStore());
+    newStore->reserveValues(capacity);
 
-    // Copy the previous data over to the new underlying array. This could be done faster possibly.
-    for(size_t idx = 0; idx < numTuples; idx++)
+    // Move the preserved values over to the new underlying array with a single bulk copy.
+    // A pooled store may hold appended values beyond its not yet synced tuple shape.
+    const size_t numStoredValues = nullptr != pooledStore ? pooledStore->getCapacity() : m_DataArray->getSize();
+    const size_t numValuesToCopy = std::min(numLogicalTuples * getNumComponents(), numStoredValues);
+    ValueType* newData = newStore->data();
+    if(numValuesToCopy > 0 && nullptr != m_RawData)
     {
-      (*copyOfDataArrayPtr.get())[idx] = (*m_DataArray)[idx];
+      std::copy_n(m_RawData, numValuesToCopy, newData);
+    }
+    else
+    {
+      for(size_t idx = 0; idx < numValuesToCopy; idx++)
+      {
+        newData[idx] = readValue(idx);
+      }
     }
 
     // Now swap the vtkDataArrays
     m_DataArray = copyOfDataArrayPtr;
+    updateStorageCache();
 
-    // Now update the vtkGenericDataArray internal values
+    // Now update the vtkGenericDataArray internal values. MaxId is owned by
+    // vtkGenericDataArray::Resize, which truncates it if the array shrank.
     this->NumberOfComponents = m_DataArray->getNumberOfComponents();
-    this->Size = numTuples * this->NumberOfComponents;
-    this->MaxId = this->Size - 1;
+    this->Size = static_cast<vtkIdType>(capacity);
 
     return true;
   }
 
+  /**
+   * @brief Sets the number of values, growing the capacity if needed, and makes the
+   * complex::DataArray report the new number of tuples.
+   * @param numValues
+   * @return bool
+   */
+  bool SetNumberOfValues(vtkIdType numValues) override
+  {
+    if(!Superclass::SetNumberOfValues(numValues))
+    {
+      return false;
+    }
+    syncComplexTupleCount();
+    return true;
+  }
+
+  /**
+   * @brief Shrinks the capacity to the logical size and makes the complex::DataArray
+   * report the logical number of tuples.
+   */
+  void Squeeze() override
+  {
+    Superclass::Squeeze();
+    syncComplexTupleCount();
+  }
+
+  /**
+   * @brief Returns a pointer to the value at valueIdx.
+   *
+   * Contiguous stores return a pointer into the store. Other stores are staged on the
+   * first call: all values are copied into a contiguous buffer, and from then on all
+   * element access, including writes through the returned pointer, uses that buffer.
+   * Staging is serialized, so concurrent first calls copy the store once.
+   *
+   * Writes through this array's API are tracked per block of tuples. Writes through the
+   * returned pointer cannot be seen: report them with MarkTuplesDirty(), otherwise the
+   * next write back compares the buffer with the store block by block and writes the
+   * blocks that differ. DataChanged(), ReleaseStagedValues(), SetComplexArray() and the
+   * destructor write back. HDF5 chunked stores are read-only: values written to their
+   * staging buffer cannot be written back, which the write back reports as an error.
+   * Returns nullptr if there is no store or staging is disabled.
+   * @param valueIdx
+   * @return void*
+   */
   void* GetVoidPointer(vtkIdType valueIdx) override
   {
-    auto dataStore = dynamic_cast<complex::DataStore<T>*>(m_DataArray->getDataStore());
-    if(nullptr == dataStore)
+    if(nullptr == m_RawData && !stageValues())
     {
       return nullptr;
     }
-    return dataStore->data();
+    if(m_Staged)
+    {
+      m_UnreportedPointerWrites = true;
+    }
+    return m_RawData + valueIdx;
+  }
+
+  /**
+   * @brief Writes the dirty staged values back to the store before notifying VTK that
+   * the values changed. The staging buffer stays in use. With dirty tracking enabled,
+   * the whole array is marked as dirty since the changed tuples are unknown.
+   */
+  void DataChanged() override
+  {
+    notifyValuesChanged(true);
+  }
+
+  /**
+   * @brief Returns true if the values are stored in a single contiguous AOS buffer.
+   * @return bool
+   */
+  bool HasStandardMemoryLayout() const override
+  {
+    return m_RawData != nullptr;
+  }
+
+  /**
+   * @brief Copies the tuple at srcTupleIdx in source to dstTupleIdx in this array.
+   * Contiguous sources of the same value type are copied directly.
+   * @param dstTupleIdx
+   * @param srcTupleIdx
+   * @param source
+   */
+  void SetTuple(vtkIdType dstTupleIdx, vtkIdType srcTupleIdx, vtkAbstractArray* source) override
+  {
+    const ValueType* sourceData = getContiguousPointer(source);
+    if(sourceData == nullptr || m_RawData == nullptr || source->GetNumberOfComponents() != this->NumberOfComponents)
+    {
+      Superclass::SetTuple(dstTupleIdx, srcTupleIdx, source);
+      return;
+    }
+    const int numComps = getNumComponents();
+    copyTuple(sourceData + srcTupleIdx * numComps, m_RawData + dstTupleIdx * numComps);
+    markDirty(dstTupleIdx);
+  }
+
+  /**
+   * @brief Copies n consecutive tuples starting at srcStart in source to dstStart in
+   * this array, growing this array if needed. Contiguous sources of the same value
+   * type are copied with a single block copy.
+   * @param dstStart
+   * @param n
+   * @param srcStart
+   * @param source
+   */
+  void InsertTuples(vtkIdType dstStart, vtkIdType n, vtkIdType srcStart, vtkAbstractArray* source) override
+  {
+    if(n <= 0 || !canBulkCopyFrom(source) || srcStart + n > source->GetNumberOfTuples())
+    {
+      Superclass::InsertTuples(dstStart, n, srcStart, source);
+      return;
+    }
+    if(!ensureContiguousAccessToTuple(dstStart + n - 1))
+    {
+      Superclass::InsertTuples(dstStart, n, srcStart, source);
+      return;
+    }
+
+    // Fetch the source pointer after growing, as source may be this array.
+    const ValueType* sourceData = getContiguousPointer(source);
+    const int numComps = getNumComponents();
+    std::memmove(m_RawData + dstStart * numComps, sourceData + srcStart * numComps, static_cast<size_t>(n) * numComps * sizeof(ValueType));
+    syncComplexTupleCount();
+    markDirty(dstStart, dstStart + n);
+    notifyValuesChanged(false);
+  }
+
+  /**
+   * @brief Copies the tuples in source listed in srcIds to the tuples in this array
+   * listed in dstIds, growing this array if needed.
+   * @param dstIds
+   * @param srcIds
+   * @param source
+   */
+  void InsertTuples(vtkIdList* dstIds, vtkIdList* srcIds, vtkAbstractArray* source) override
+  {
+    const vtkIdType numIds = dstIds->GetNumberOfIds();
+    if(numIds == 0 || numIds != srcIds->GetNumberOfIds() || !canBulkCopyFrom(source) || maxId(srcIds) >= source->GetNumberOfTuples())
+    {
+      Superclass::InsertTuples(dstIds, srcIds, source);
+      return;
+    }
+    if(!ensureContiguousAccessToTuple(maxId(dstIds)))
+    {
+      Superclass::InsertTuples(dstIds, srcIds, source);
+      return;
+    }
+
+    // dstIds may contain duplicates, so this scatter stays serial to keep the
+    // "last write wins" semantics of vtkGenericDataArray.
+    const ValueType* sourceData = getContiguousPointer(source);
+    const int numComps = getNumComponents();
+    const vtkIdType* srcIdPtr = srcIds->GetPointer(0);
+    const vtkIdType* dstIdPtr = dstIds->GetPointer(0);
+    for(vtkIdType i = 0; i < numIds; i++)
+    {
+      copyTuple(sourceData + srcIdPtr[i] * numComps, m_RawData + dstIdPtr[i] * numComps);
+    }
+    syncComplexTupleCount();
+    for(vtkIdType i = 0; i < numIds; i++)
+    {
+      markDirty(dstIdPtr[i]);
+    }
+    notifyValuesChanged(false);
+  }
+
+  /**
+   * @brief Copies the tuples in source listed in srcIds to consecutive tuples in this
+   * array starting at dstStart, growing this array if needed. The gather runs in
+   * parallel when source is a different array.
+   * @param dstStart
+   * @param srcIds
+   * @param source
+   */
+  void InsertTuplesStartingAt(vtkIdType dstStart, vtkIdList* srcIds, vtkAbstractArray* source) override
+  {
+    const vtkIdType numIds = srcIds->GetNumberOfIds();
+    if(numIds == 0 || !canBulkCopyFrom(source) || maxId(srcIds) >= source->GetNumberOfTuples())
+    {
+      Superclass::InsertTuplesStartingAt(dstStart, srcIds, source);
+      return;
+    }
+    if(!ensureContiguousAccessToTuple(dstStart + numIds - 1))
+    {
+      Superclass::InsertTuplesStartingAt(dstStart, srcIds, source);
+      return;
+    }
+
+    gatherTuples(getContiguousPointer(source), srcIds, m_RawData + dstStart * getNumComponents(), source != this);
+    syncComplexTupleCount();
+    markDirty(dstStart, dstStart + numIds);
+    notifyValuesChanged(false);
+  }
+
+  /**
+   * @brief Copies the tuples listed in tupleIds to consecutive tuples of output. The
+   * output must already be large enough. The gather runs in parallel when output
+   * is a different array.
+   * @param tupleIds
+   * @param output
+   */
+  void GetTuples(vtkIdList* tupleIds, vtkAbstractArray* output) override
+  {
+    const vtkIdType numIds = tupleIds->GetNumberOfIds();
+    ValueType* outputData = getContiguousPointer(output);
+    if(numIds == 0 || m_RawData == nullptr || outputData == nullptr || output->GetNumberOfComponents() != this->NumberOfComponents || output->GetNumberOfTuples() < numIds ||
+       maxId(tupleIds) >= this->GetNumberOfTuples())
+    {
+      Superclass::GetTuples(tupleIds, output);
+      return;
+    }
+
+    gatherTuples(m_RawData, tupleIds, outputData, output != this);
+  }
+
+  /**
+   * @brief Copies the tuples p1 through p2 (inclusive) to the start of output. The
+   * output must already be large enough. Contiguous and staged arrays copy from their
+   * buffer, which holds values not yet written back. Otherwise run-length encoded and
+   * HDF5 chunked stores copy block by block or chunk by chunk.
+   * @param p1
+   * @param p2
+   * @param output
+   */
+  void GetTuples(vtkIdType p1, vtkIdType p2, vtkAbstractArray* output) override
+  {
+    const vtkIdType numTuples = p2 - p1 + 1;
+    ValueType* outputData = getContiguousPointer(output);
+    const bool hasBlockCopy = m_RawData != nullptr || m_RunLengthStore != nullptr || m_ChunkedStore != nullptr;
+    if(numTuples <= 0 || p1 < 0 || p2 >= this->GetNumberOfTuples() || !hasBlockCopy || outputData == nullptr || output->GetNumberOfComponents() != this->NumberOfComponents ||
+       output->GetNumberOfTuples() < numTuples)
+    {
+      Superclass::GetTuples(p1, p2, output);
+      return;
+    }
+
+    const int numComps = getNumComponents();
+    const size_t startValue = static_cast<size_t>(p1) * numComps;
+    const size_t numValues = static_cast<size_t>(numTuples) * numComps;
+    if(nullptr != m_RawData)
+    {
+      std::memmove(outputData, m_RawData + startValue, numValues * sizeof(ValueType));
+      return;
+    }
+    if(nullptr != m_RunLengthStore)
+    {
+      m_RunLengthStore->copyValues(startValue, numValues, outputData);
+      return;
+    }
+    m_ChunkedStore->copyValues(startValue, numValues, outputData);
+  }
+
+  /**
+   * @brief Deep copies other into this array. Contiguous arrays of the same value type
+   * are copied with a single block copy instead of a per-component dispatch.
+   * @param other
+   */
+  void DeepCopy(vtkDataArray* other) override
+  {
+    if(other == nullptr || other == this || !canBulkCopyFrom(other, false))
+    {
+      Superclass::DeepCopy(other);
+      return;
+    }
+
+    // Copies the information, name and component names
+    vtkAbstractArray::DeepCopy(other);
+
+    const vtkIdType numTuples = other->GetNumberOfTuples();
+    this->SetNumberOfComponents(other->GetNumberOfComponents());
+    this->SetNumberOfTuples(numTuples);
+    if(numTuples > 0)
+    {
+      const ValueType* sourceData = getContiguousPointer(other);
+      const vtkIdType numValues = numTuples * other->GetNumberOfComponents();
+      if(m_RawData != nullptr)
+      {
+        std::memcpy(m_RawData, sourceData, static_cast<size_t>(numValues) * sizeof(ValueType));
+      }
+      else
+      {
+        for(vtkIdType valueIdx = 0; valueIdx < numValues; valueIdx++)
+        {
+          SetValue(valueIdx, sourceData[valueIdx]);
+        }
+      }
+      markDirty(0, numTuples);
+    }
+
+    this->SetLookupTable(nullptr);
+    if(vtkLookupTable* otherLookupTable = other->GetLookupTable())
+    {
+      vtkLookupTable* lookupTable = otherLookupTable->NewInstance();
+      lookupTable->DeepCopy(otherLookupTable);
+      this->SetLookupTable(lookupTable);
+      lookupTable->Delete();
+    }
+    this->DataChanged();
   }
 
 protected:
+  /**
+   * @brief Creates the array returned by NewInstance() according to the bridge-wide
+   * CV::NewInstancePolicy. Under NewInstancePolicy::VtkArray this is a plain VTK array.
+   * Otherwise it is a CV::Array<T, k_DynamicComponents>, since VTK sets the number of
+   * components of the new instance after creating it.
+   * @return vtkObjectBase*
+   */
   vtkObjectBase* NewInstanceInternal() const override
   {
+    if(CV::ArrayPool::GetNewInstancePolicy() == CV::NewInstancePolicy::VtkArray)
+    {
+      CV::ArrayPool::CountVtkArray();
+      return vtkDataArray::CreateDataArray(this->GetDataType());
+    }
     ComplexArrayPointerType copyOfDataArrayPtr = createNewDataArray(0);
-    return new Array(copyOfDataArrayPtr);
+    return new CV::Array<T, k_DynamicComponents>(copyOfDataArrayPtr);
+  }
+
+  /**
+   * @brief Computes the per-component range in parallel. The result is cached until
+   * the array's modification time changes. NaN values are ignored.
+   * @param ranges
+   * @return bool
+   */
+  bool ComputeScalarRange(double* ranges) override
+  {
+    return computeCachedRange(m_ScalarRangeCache, ranges, 2 * this->NumberOfComponents, [this](double* result) { return CV::Range::ComputeComponentRanges<false>(this, result); });
+  }
+
+  /**
+   * @brief Computes the range of the tuple magnitudes in parallel. The result is cached
+   * until the array's modification time changes. Tuples containing NaN are ignored.
+   * @param range
+   * @return bool
+   */
+  bool ComputeVectorRange(double range[2]) override
+  {
+    return computeCachedRange(m_VectorRangeCache, range, 2, [this](double* result) { return CV::Range::ComputeMagnitudeRange<false>(this, result); });
+  }
+
+  /**
+   * @brief Computes the per-component range of finite values in parallel. The result is
+   * cached until the array's modification time changes.
+   * @param ranges
+   * @return bool
+   */
+  bool ComputeFiniteScalarRange(double* ranges) override
+  {
+    return computeCachedRange(m_FiniteScalarRangeCache, ranges, 2 * this->NumberOfComponents, [this](double* result) { return CV::Range::ComputeComponentRanges<true>(this, result); });
+  }
+
+  /**
+   * @brief Computes the range of the magnitudes of finite tuples in parallel. The result
+   * is cached until the array's modification time changes.
+   * @param range
+   * @return bool
+   */
+  bool ComputeFiniteVectorRange(double range[2]) override
+  {
+    return computeCachedRange(m_FiniteVectorRangeCache, range, 2, [this](double* result) { return CV::Range::ComputeMagnitudeRange<true>(this, result); });
   }
 
 private:
+  /**
+   * @brief Range computed for a given modification time of the array.
+   */
+  struct RangeCache
+  {
+    bool valid = false;
+    vtkMTimeType mTime = 0;
+    bool result = false;
+    std::vector<double> ranges;
+  };
+
   ComplexArrayPointerType m_DataArray;
+  complex::AbstractDataStore<T>* m_DataStore = nullptr;
+  CV::RunLengthDataStore<T>* m_RunLengthStore = nullptr;
+  const CV::ChunkedValueReader<T>* m_ChunkedStore = nullptr;
+  ValueType* m_RawData = nullptr;
+  bool m_ContiguousStore = false;
+  std::vector<ValueType> m_StagingBuffer;
+  std::unique_ptr<CV::DirtyTupleRanges> m_StagedTuples;
+  std::atomic<bool> m_Staged{false};
+  std::atomic<bool> m_UnreportedPointerWrites{false};
+  bool m_StagingEnabled = true;
+  std::mutex m_StagingMutex;
+  uint64_t m_NumberOfMaterializations = 0;
+  uint64_t m_NumberOfWriteBacks = 0;
+  std::shared_ptr<CV::DirtyTupleRanges> m_DirtyRanges;
+  CV::DirtyTupleRanges* m_DirtyTracker = nullptr;
+  const complex::IDataArray* m_TrackedArray = nullptr;
+  RangeCache m_ScalarRangeCache;
+  RangeCache m_VectorRangeCache;
+  RangeCache m_FiniteScalarRangeCache;
+  RangeCache m_FiniteVectorRangeCache;
+
+  /**
+   * @brief Returns the cached range if it was computed for the current modification
+   * time. Otherwise the range is recomputed using computeFunc and cached.
+   *
+   * Changes made directly to the complex::DataArray are not visible to VTK, so
+   * Modified() must be called on this array after such changes.
+   * @param cache
+   * @param ranges
+   * @param numValues
+   * @param computeFunc
+   * @return bool
+   */
+  template <typename ComputeFuncT>
+  bool computeCachedRange(RangeCache& cache, double* ranges, int numValues, ComputeFuncT&& computeFunc)
+  {
+    const vtkMTimeType mTime = this->GetMTime();
+    if(!cache.valid || cache.mTime != mTime || cache.ranges.size() != static_cast<size_t>(numValues))
+    {
+      cache.ranges.resize(numValues);
+      cache.result = computeFunc(cache.ranges.data());
+      cache.mTime = mTime;
+      cache.valid = true;
+    }
+    std::copy(cache.ranges.begin(), cache.ranges.end(), ranges);
+    return cache.result;
+  }
+
+  /**
+   * @brief Returns the contiguous value buffer of array if it stores the same value type
+   * as this array in a standard AOS memory layout, otherwise nullptr.
+   * @param array
+   * @return ValueType*
+   */
+  ValueType* getContiguousPointer(vtkAbstractArray* array) const
+  {
+    if(array == nullptr || array->GetDataType() != this->GetDataType() || !array->HasStandardMemoryLayout())
+    {
+      return nullptr;
+    }
+    return static_cast<ValueType*>(array->GetVoidPointer(0));
+  }
+
+  /**
+   * @brief Returns true if tuples can be block copied from source into this array.
+   * @param source
+   * @param requireContiguousDestination
+   * @return bool
+   */
+  bool canBulkCopyFrom(vtkAbstractArray* source, bool requireContiguousDestination = true) const
+  {
+    if(getContiguousPointer(source) == nullptr || (requireContiguousDestination && !m_ContiguousStore))
+    {
+      return false;
+    }
+    if constexpr(k_HasFixedComponents)
+    {
+      return source->GetNumberOfComponents() == k_NumComponents;
+    }
+    else
+    {
+      return !requireContiguousDestination || source->GetNumberOfComponents() == this->NumberOfComponents;
+    }
+  }
+
+  /**
+   * @brief Grows the array so that tupleIdx is accessible and returns true if the
+   * storage is still contiguous afterwards.
+   * @param tupleIdx
+   * @return bool
+   */
+  bool ensureContiguousAccessToTuple(vtkIdType tupleIdx)
+  {
+    if(tupleIdx >= this->GetNumberOfTuples() && !this->EnsureAccessToTuple(tupleIdx))
+    {
+      return false;
+    }
+    return m_RawData != nullptr;
+  }
+
+  /**
+   * @brief Returns the largest id in the list.
+   * @param ids
+   * @return vtkIdType
+   */
+  static vtkIdType maxId(vtkIdList* ids)
+  {
+    const vtkIdType* idPtr = ids->GetPointer(0);
+    const vtkIdType numIds = ids->GetNumberOfIds();
+    return numIds == 0 ? -1 : *std::max_element(idPtr, idPtr + numIds);
+  }
+
+  /**
+   * @brief Copies a single tuple between two contiguous buffers.
+   * @param source
+   * @param destination
+   */
+  inline void copyTuple(const ValueType* source, ValueType* destination) const
+  {
+    const int numComps = getNumComponents();
+    for(int comp = 0; comp < numComps; comp++)
+    {
+      destination[comp] = source[comp];
+    }
+  }
+
+  /**
+   * @brief Copies the tuples of source listed in ids to consecutive tuples of destination.
+   * Must only run in parallel if source and destination do not overlap.
+   * @param source
+   * @param ids
+   * @param destination
+   * @param parallel
+   */
+  void gatherTuples(const ValueType* source, vtkIdList* ids, ValueType* destination, bool parallel) const
+  {
+    const vtkIdType* idPtr = ids->GetPointer(0);
+    const int numComps = getNumComponents();
+    auto gather = [this, source, idPtr, destination, numComps](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        copyTuple(source + idPtr[i] * numComps, destination + i * numComps);
+      }
+    };
+    if(parallel)
+    {
+      vtkSMPTools::For(0, ids->GetNumberOfIds(), gather);
+    }
+    else
+    {
+      gather(0, ids->GetNumberOfIds());
+    }
+  }
+
+  /**
+   * @brief Invalidates all cached ranges.
+   */
+  void clearRangeCaches()
+  {
+    m_ScalarRangeCache.valid = false;
+    m_VectorRangeCache.valid = false;
+    m_FiniteScalarRangeCache.valid = false;
+    m_FiniteVectorRangeCache.valid = false;
+  }
+
+  /**
+   * @brief Returns the number of components per tuple. This is a compile-time
+   * constant for fixed component instantiations.
+   * @return int
+   */
+  inline int getNumComponents() const
+  {
+    if constexpr(k_HasFixedComponents)
+    {
+      return k_NumComponents;
+    }
+    else
+    {
+      return this->NumberOfComponents;
+    }
+  }
+
+  /**
+   * @brief Caches the DataStore of the current DataArray. If that DataStore is
+   * contiguous (see CV::IsContiguousStore), its data pointer is cached as well so that
+   * element access can bypass the virtual AbstractDataStore interface. This must
+   * be called every time m_DataArray or its DataStore is replaced. Any staging buffer
+   * is dropped without being written back.
+   */
+  void updateStorageCache()
+  {
+    clearRangeCaches();
+    m_StagingBuffer = std::vector<ValueType>();
+    m_StagedTuples.reset();
+    m_Staged = false;
+    m_UnreportedPointerWrites = false;
+    m_DataStore = nullptr;
+    m_RunLengthStore = nullptr;
+    m_ChunkedStore = nullptr;
+    m_RawData = nullptr;
+    m_ContiguousStore = false;
+    if(m_DataArray == nullptr)
+    {
+      return;
+    }
+    m_DataStore = m_DataArray->getDataStore();
+    // An empty DataStore may not have a buffer yet, so contiguity is tracked separately
+    m_ContiguousStore = CV::IsContiguousStore(m_DataStore);
+    m_RawData = CV::GetContiguousData(m_DataStore);
+    m_RunLengthStore = dynamic_cast<CV::RunLengthDataStore<T>*>(m_DataStore);
+    m_ChunkedStore = dynamic_cast<const CV::ChunkedValueReader<T>*>(m_DataStore);
+    updateDirtyTracking();
+  }
+
+  /**
+   * @brief Resizes the dirty tuple tracker to the current DataArray and registers it for
+   * that DataArray.
+   */
+  void updateDirtyTracking()
+  {
+    if(nullptr == m_DirtyTracker)
+    {
+      return;
+    }
+    if(m_TrackedArray != nullptr && m_TrackedArray != m_DataArray.get())
+    {
+      CV::DirtyTupleRanges::Unregister(*m_TrackedArray, m_DirtyTracker);
+      m_TrackedArray = nullptr;
+    }
+    m_DirtyTracker->resize(m_DataArray == nullptr ? 0 : m_DataArray->getNumberOfTuples());
+    if(m_DataArray != nullptr && m_TrackedArray == nullptr)
+    {
+      CV::DirtyTupleRanges::Register(*m_DataArray, m_DirtyRanges);
+      m_TrackedArray = m_DataArray.get();
+    }
+  }
+
+  /**
+   * @brief Marks the tuple as dirty if dirty tracking is enabled and as written if the
+   * array is staged.
+   * @param tupleIdx
+   */
+  inline void markDirty(vtkIdType tupleIdx)
+  {
+    if(nullptr != m_DirtyTracker)
+    {
+      m_DirtyTracker->markTuple(static_cast<size_t>(tupleIdx));
+    }
+    if(nullptr != m_StagedTuples)
+    {
+      m_StagedTuples->markTuple(static_cast<size_t>(tupleIdx));
+    }
+  }
+
+  /**
+   * @brief Marks the tuples [begin, end) as dirty if dirty tracking is enabled and as
+   * written if the array is staged.
+   * @param begin
+   * @param end
+   */
+  void markDirty(vtkIdType begin, vtkIdType end)
+  {
+    if(nullptr != m_DirtyTracker)
+    {
+      m_DirtyTracker->markTuples(static_cast<size_t>(begin), static_cast<size_t>(end));
+    }
+    if(nullptr != m_StagedTuples)
+    {
+      m_StagedTuples->markTuples(static_cast<size_t>(begin), static_cast<size_t>(end));
+    }
+  }
+
+  /**
+   * @brief Copies all values of a non-contiguous DataStore into the staging buffer and
+   * points m_RawData at it. Returns false if there is nothing to stage or staging is
+   * disabled.
+   * @return bool
+   */
+  bool stageValues()
+  {
+    std::lock_guard<std::mutex> lock(m_StagingMutex);
+    if(m_Staged || !m_StagingEnabled || nullptr == m_DataStore || m_ContiguousStore)
+    {
+      return m_Staged;
+    }
+    const size_t numValues = m_DataStore->getNumberOfTuples() * m_DataStore->getNumberOfComponents();
+    if(numValues == 0)
+    {
+      return false;
+    }
+    m_StagingBuffer.resize(numValues);
+    if(nullptr != m_RunLengthStore)
+    {
+      m_RunLengthStore->copyValues(0, numValues, m_StagingBuffer.data());
+    }
+    else if(nullptr != m_ChunkedStore)
+    {
+      m_ChunkedStore->copyValues(0, numValues, m_StagingBuffer.data());
+    }
+    else
+    {
+      for(size_t idx = 0; idx < numValues; idx++)
+      {
+        m_StagingBuffer[idx] = m_DataStore->getValue(idx);
+      }
+    }
+    m_StagedTuples = std::make_unique<CV::DirtyTupleRanges>(m_DataStore->getNumberOfTuples());
+    m_UnreportedPointerWrites = false;
+    m_RawData = m_StagingBuffer.data();
+    m_Staged = true;
+
+    m_NumberOfMaterializations++;
+    StagingCounters::Materializations++;
+    StagingCounters::MaterializedBytes += numValues * sizeof(ValueType);
+    return true;
+  }
+
+  /**
+   * @brief Writes the written part of the staging buffer back to the DataStore. The
+   * buffer stays in use, as VTK may still hold pointers into it. If values were written
+   * through the pointer returned by GetVoidPointer() without being reported, the blocks
+   * that differ from the store are marked first. Run-length encoded stores re-encode
+   * only the blocks in the written ranges. HDF5 chunked stores are read-only, so
+   * written values are reported as an error instead; they stay in the buffer until it
+   * is released.
+   */
+  void flushStagedValues()
+  {
+    std::lock_guard<std::mutex> lock(m_StagingMutex);
+    if(!m_Staged || nullptr == m_DataStore || nullptr == m_StagedTuples)
+    {
+      return;
+    }
+    const size_t numComps = m_DataStore->getNumberOfComponents();
+    const size_t numValues = std::min(m_StagingBuffer.size(), m_DataStore->getNumberOfTuples() * numComps);
+    if(m_UnreportedPointerWrites)
+    {
+      markChangedStagedBlocks(numValues);
+      m_UnreportedPointerWrites = false;
+    }
+    if(nullptr != m_ChunkedStore)
+    {
+      if(!m_StagedTuples->isEmpty())
+      {
+        vtkErrorMacro(<< m_StagedTuples->getNumberOfDirtyTuples() << " staged tuples were written, but the HDF5 chunked store is read-only. The values are lost when the staging buffer is released.");
+        m_StagedTuples->clear();
+      }
+      return;
+    }
+
+    size_t numValuesWritten = 0;
+    for(const auto& range : m_StagedTuples->getRanges())
+    {
+      const size_t begin = std::min(range.first * numComps, numValues);
+      const size_t end = std::min(range.second * numComps, numValues);
+      if(nullptr != m_RunLengthStore)
+      {
+        m_RunLengthStore->assignValues(begin, end - begin, m_StagingBuffer.data() + begin);
+      }
+      else
+      {
+        for(size_t idx = begin; idx < end; idx++)
+        {
+          m_DataStore->setValue(idx, m_StagingBuffer[idx]);
+        }
+      }
+      numValuesWritten += end - begin;
+    }
+    m_StagedTuples->clear();
+    if(numValuesWritten == 0)
+    {
+      return;
+    }
+
+    m_NumberOfWriteBacks++;
+    StagingCounters::WriteBacks++;
+    StagingCounters::WrittenBackBytes += numValuesWritten * sizeof(ValueType);
+  }
+
+  /**
+   * @brief Compares the staging buffer with the store block by block and marks the
+   * blocks that differ as written. The comparison is bitwise so that NaN values
+   * compare equal to themselves.
+   * @param numValues
+   */
+  void markChangedStagedBlocks(size_t numValues)
+  {
+    const size_t numComps = m_DataStore->getNumberOfComponents();
+    const size_t blockValues = m_StagedTuples->getBlockSize() * numComps;
+    std::vector<ValueType> storeValues(std::min(blockValues, numValues));
+    for(size_t begin = 0; begin < numValues; begin += blockValues)
+    {
+      const size_t count = std::min(blockValues, numValues - begin);
+      if(nullptr != m_RunLengthStore)
+      {
+        m_RunLengthStore->copyValues(begin, count, storeValues.data());
+      }
+      else if(nullptr != m_ChunkedStore)
+      {
+        m_ChunkedStore->copyValues(begin, count, storeValues.data());
+      }
+      else
+      {
+        for(size_t idx = 0; idx < count; idx++)
+        {
+          storeValues[idx] = m_DataStore->getValue(begin + idx);
+        }
+      }
+      if(std::memcmp(storeValues.data(), m_StagingBuffer.data() + begin, count * sizeof(ValueType)) != 0)
+      {
+        m_StagedTuples->markTuples(begin / numComps, (begin + count) / numComps);
+      }
+    }
+  }
+
+  /**
+   * @brief Makes the complex::DataArray report the logical number of tuples, writes the
+   * dirty staged values back and notifies VTK that the values changed. DataChanged()
+   * and the bulk InsertTuples() overrides share this, so none of them skips the write
+   * back.
+   * @param markAllDirty true if the written tuples are unknown and the whole array must
+   * be marked as dirty
+   */
+  void notifyValuesChanged(bool markAllDirty)
+  {
+    syncComplexTupleCount();
+    flushStagedValues();
+    if(markAllDirty && nullptr != m_DirtyTracker)
+    {
+      m_DirtyTracker->markAll();
+    }
+    Superclass::DataChanged();
+  }
+
+  /**
+   * @brief Reads a value from a non-contiguous DataStore. Run-length encoded stores are
+   * called through their final type so that the per-thread block lookup is inlined
+   * instead of going through the virtual AbstractDataStore interface.
+   * @param valueIdx
+   * @return T
+   */
+  inline ValueType readValue(vtkIdType valueIdx) const
+  {
+    if(nullptr != m_RunLengthStore)
+    {
+      return m_RunLengthStore->getValue(valueIdx);
+    }
+    return m_DataStore->getValue(valueIdx);
+  }
 
   /**
-   * @brief Creates and returns a new DataArray<T> with a new DataStore<T>
+   * @brief Sets the tuple count of a CV::PooledDataStore<T> to the logical number of
+   * tuples of this array. The buffer already holds the values, so this neither
+   * reallocates nor moves them. Called by SetNumberOfValues(), Squeeze(), DataChanged()
+   * and the bulk InsertTuples() overrides. Tuples appended one at a time, e.g. with InsertNextTuple(), become visible to
+   * complex at the next of those calls. Appended tuples are marked as dirty.
+   */
+  void syncComplexTupleCount()
+  {
+    auto* pooledStore = dynamic_cast<CV::PooledDataStore<T>*>(m_DataStore);
+    const auto numTuples = static_cast<size_t>(this->GetNumberOfTuples());
+    if(nullptr == pooledStore || pooledStore->getNumberOfTuples() == numTuples || numTuples * getNumComponents() > pooledStore->getCapacity())
+    {
+      return;
+    }
+    const size_t oldNumTuples = pooledStore->getNumberOfTuples();
+    pooledStore->reshapeTuples({numTuples});
+    if(nullptr != m_DirtyTracker)
+    {
+      m_DirtyTracker->resize(numTuples);
+      m_DirtyTracker->markTuples(oldNumTuples, numTuples);
+    }
+  }
+
+  /**
+   * @brief Resizes the current DataStore in place if it is a CV::PooledDataStore<T>.
+   * Returns false for all other stores.
+   * @param numTuples
+   * @return bool
+   */
+  bool reshapePooledStore(vtkIdType numTuples)
+  {
+    auto* pooledStore = dynamic_cast<CV::PooledDataStore<T>*>(m_DataStore);
+    if(nullptr == pooledStore || pooledStore->getNumberOfComponents() != static_cast<size_t>(this->NumberOfComponents))
+    {
+      return false;
+    }
+    pooledStore->reshapeTuples({static_cast<size_t>(numTuples)});
+    return true;
+  }
+
+  /**
+   * @brief Creates and returns a new DataArray<T> with a new DataStore<T>, or a
+   * CV::PooledDataStore<T> if pooled is true or under NewInstancePolicy::PooledComplexArray.
    * @param numTuples The number of tuples to create in the DataStore<T>.
+   * @param pooled
    * @return
    */
-  ComplexArrayPointerType createNewDataArray(vtkIdType numTuples) const
+  ComplexArrayPointerType createNewDataArray(vtkIdType numTuples, bool pooled = false) const
   {
-    // Create a brand-new instance of DataArray<T> with its own underlying DataStore of the same
-    // type as the original DataArray<T> instance
-    using DataStoreType = complex::DataStore<T>;
-    using SharedDataStoreType = std::shared_ptr<DataStoreType>;
-    std::shared_ptr<complex::DataStore<T>> dataStore = SharedDataStoreType(new DataStoreType({static_cast<size_t>(numTuples)}, {static_cast<size_t>(this->NumberOfComponents)}));
+    // Create a brand-new instance of DataArray<T> with its own underlying DataStore
+    const std::vector<size_t> tupleShape = {static_cast<size_t>(numTuples)};
+    const std::vector<size_t> componentShape = {static_cast<size_t>(this->NumberOfComponents)};
+    std::shared_ptr<complex::AbstractDataStore<T>> dataStore;
+    if(pooled || CV::ArrayPool::GetNewInstancePolicy() == CV::NewInstancePolicy::PooledComplexArray)
+    {
+      dataStore = std::make_shared<CV::PooledDataStore<T>>(tupleShape, componentShape);
+    }
+    else
+    {
+      dataStore = std::make_shared<complex::DataStore<T>>(tupleShape, componentShape);
+    }
+    CV::ArrayPool::CountComplexArray();
     // Shallow Copy from the previous DataArray to get an instance of DataArray
     ComplexArrayType* copyOfDataArray = dynamic_cast<ComplexArrayType*>(m_DataArray->shallowCopy());
     ComplexArrayPointerType copyOfDataArrayPtr = std::shared_ptr<ComplexArrayType>(copyOfDataArray);
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+#include <vtkArrayDispatch.h>
+#include <vtkDataArray.h>
+#include <vtkSMPTools.h>
+#include <vtkTypeList.h>
+
+#include "complex2VtkLib/VtkBridge/CVArray.hpp"
+
+namespace CV
+{
+namespace Dispatch
+{
+/**
+ * @brief All CV::Array instantiations for a single component count covering the
+ * value types handled by VtkBridge::wrapDataArray.
+ * @tparam NumComps
+ */
+template <int NumComps>
+using ArraysWithComponents = vtkTypeList::Create<CV::Array<int8_t, NumComps>, CV::Array<int16_t, NumComps>, CV::Array<int32_t, NumComps>, CV::Array<int64_t, NumComps>, CV::Array<uint8_t, NumComps>,
+                                                 CV::Array<uint16_t, NumComps>, CV::Array<uint32_t, NumComps>, CV::Array<uint64_t, NumComps>, CV::Array<float, NumComps>, CV::Array<double, NumComps>>;
+
+/**
+ * @brief Every CV::Array instantiation that VtkBridge::wrapDataArray can create. This
+ * must be kept in sync with the component counts selected in wrapDataArray.
+ */
+using CVArrays = vtkTypeList::Append<vtkTypeList::Append<vtkTypeList::Append<vtkTypeList::Append<ArraysWithComponents<k_DynamicComponents>, ArraysWithComponents<1>>::Result, ArraysWithComponents<3>>::Result,
+                                                         ArraysWithComponents<4>>::Result,
+                                     ArraysWithComponents<9>>::Result;
+
+#ifdef C2V_DISPATCH_VTK_ARRAYS
+/**
+ * @brief The CV::Array instantiations followed by VTK's default dispatch arrays so that
+ * a single dispatch handles both wrapped complex arrays and native VTK arrays.
+ */
+using Arrays = vtkTypeList::Append<CVArrays, vtkArrayDispatch::Arrays>::Result;
+#else
+/**
+ * @brief The CV::Array instantiations only. Native VTK arrays are not dispatched.
+ */
+using Arrays = CVArrays;
+#endif
+
+/**
+ * @brief Calls worker(typedArray, params...) with the array cast to its concrete
+ * CV::Array (or VTK array) type. VTK's own dispatch lists do not contain the
+ * CV::Array types, so vtkArrayDispatch::Dispatch would never hit the typed path
+ * for wrapped complex arrays.
+ *
+ * Returns false if the array type is not part of Dispatch::Arrays.
+ * @param array
+ * @param worker
+ * @param params
+ * @return bool
+ */
+template <typename Worker, typename... Params>
+bool Execute(vtkDataArray* array, Worker&& worker, Params&&... params)
+{
+  return vtkArrayDispatch::DispatchByArray<Arrays>::Execute(array, std::forward<Worker>(worker), std::forward<Params>(params)...);
+}
+
+/**
+ * @brief Calls worker(typedArray1, typedArray2, params...) for two arrays that share
+ * the same value type, with both arrays cast to their concrete types.
+ *
+ * Returns false if either array type is not part of Dispatch::Arrays or the value
+ * types differ.
+ * @param array1
+ * @param array2
+ * @param worker
+ * @param params
+ * @return bool
+ */
+template <typename Worker, typename... Params>
+bool Execute2SameValueType(vtkDataArray* array1, vtkDataArray* array2, Worker&& worker, Params&&... params)
+{
+  return vtkArrayDispatch::Dispatch2ByArrayWithSameValueType<Arrays, Arrays>::Execute(array1, array2, std::forward<Worker>(worker), std::forward<Params>(params)...);
+}
+
+/**
+ * @brief Runs functor(typedArray, beginTuple, endTuple) over all tuples of the array
+ * using vtkSMPTools. The functor receives the concrete array type, so component
+ * access compiles down to the inlined CV::Array accessors instead of the
+ * double-valued vtkDataArray::GetTuple API.
+ *
+ * Returns false if the array type is not part of Dispatch::Arrays.
+ * @param array
+ * @param functor
+ * @return bool
+ */
+template <typename Functor>
+bool ParallelForTuples(vtkDataArray* array, Functor&& functor)
+{
+  auto worker = [&functor](auto* typedArray) {
+    vtkSMPTools::For(0, typedArray->GetNumberOfTuples(), [&functor, typedArray](vtkIdType begin, vtkIdType end) { functor(typedArray, begin, end); });
+  };
+  return Execute(array, worker);
+}
+
+/**
+ * @brief Calls functor(typedArray, tupleIdx) for every tuple of the array in order
+ * with the array cast to its concrete type.
+ *
+ * Returns false if the array type is not part of Dispatch::Arrays.
+ * @param array
+ * @param functor
+ * @return bool
+ */
+template <typename Functor>
+bool ForEachTuple(vtkDataArray* array, Functor&& functor)
+{
+  auto worker = [&functor](auto* typedArray) {
+    const vtkIdType numTuples = typedArray->GetNumberOfTuples();
+    for(vtkIdType tupleIdx = 0; tupleIdx < numTuples; tupleIdx++)
+    {
+      functor(typedArray, tupleIdx);
+    }
+  };
+  return Execute(array, worker);
+}
+} // namespace Dispatch
+} // namespace CV
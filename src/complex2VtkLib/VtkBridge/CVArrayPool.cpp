@@ -0,0 +1,174 @@
+#include "CVArrayPool.hpp"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+using namespace CV;
+
+namespace
+{
+constexpr size_t k_Alignment = 64;
+constexpr size_t k_MinClassBytes = 64;
+constexpr size_t k_NumSizeClasses = 48;
+
+/**
+ * @brief Shared state of CV::ArrayPool.
+ */
+struct PoolState
+{
+  std::atomic<NewInstancePolicy> policy{NewInstancePolicy::ComplexArray};
+  std::mutex mutex;
+  std::array<std::vector<void*>, k_NumSizeClasses> freeBuffers;
+  size_t pooledBytes = 0;
+  size_t maxPooledBytes = ArrayPool::k_DefaultMaxPooledBytes;
+  std::atomic<uint64_t> vtkArrays{0};
+  std::atomic<uint64_t> complexArrays{0};
+  std::atomic<uint64_t> allocations{0};
+  std::atomic<uint64_t> reuses{0};
+};
+
+PoolState& GetPoolState()
+{
+  static PoolState state;
+  return state;
+}
+
+/**
+ * @brief Returns the size class of a buffer of bytes bytes. Class i holds buffers of
+ * k_MinClassBytes << i bytes.
+ * @param bytes
+ * @return size_t
+ */
+size_t SizeClass(size_t bytes)
+{
+  size_t sizeClass = 0;
+  while((k_MinClassBytes << sizeClass) < bytes)
+  {
+    sizeClass++;
+  }
+  return sizeClass;
+}
+
+void FreeBuffer(void* buffer)
+{
+  ::operator delete(buffer, std::align_val_t(k_Alignment));
+}
+} // namespace
+
+void ArrayPool::SetNewInstancePolicy(NewInstancePolicy policy)
+{
+  GetPoolState().policy = policy;
+}
+
+NewInstancePolicy ArrayPool::GetNewInstancePolicy()
+{
+  return GetPoolState().policy;
+}
+
+void* ArrayPool::Acquire(size_t& bytes)
+{
+  PoolState& state = GetPoolState();
+  const size_t sizeClass = SizeClass(bytes);
+  if(sizeClass >= k_NumSizeClasses)
+  {
+    throw std::bad_alloc();
+  }
+  bytes = k_MinClassBytes << sizeClass;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto& freeBuffers = state.freeBuffers[sizeClass];
+    if(!freeBuffers.empty())
+    {
+      void* buffer = freeBuffers.back();
+      freeBuffers.pop_back();
+      state.pooledBytes -= bytes;
+      state.reuses++;
+      return buffer;
+    }
+  }
+  state.allocations++;
+  return ::operator new(bytes, std::align_val_t(k_Alignment));
+}
+
+void ArrayPool::Release(void* buffer, size_t bytes)
+{
+  if(buffer == nullptr)
+  {
+    return;
+  }
+  PoolState& state = GetPoolState();
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if(state.pooledBytes + bytes <= state.maxPooledBytes)
+    {
+      state.freeBuffers[SizeClass(bytes)].push_back(buffer);
+      state.pooledBytes += bytes;
+      return;
+    }
+  }
+  FreeBuffer(buffer);
+}
+
+void ArrayPool::Trim()
+{
+  PoolState& state = GetPoolState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  for(auto& freeBuffers : state.freeBuffers)
+  {
+    for(void* buffer : freeBuffers)
+    {
+      FreeBuffer(buffer);
+    }
+    freeBuffers.clear();
+  }
+  state.pooledBytes = 0;
+}
+
+void ArrayPool::SetMaxPooledBytes(size_t maxBytes)
+{
+  PoolState& state = GetPoolState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.maxPooledBytes = maxBytes;
+}
+
+size_t ArrayPool::GetMaxPooledBytes()
+{
+  PoolState& state = GetPoolState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.maxPooledBytes;
+}
+
+void ArrayPool::CountVtkArray()
+{
+  GetPoolState().vtkArrays++;
+}
+
+void ArrayPool::CountComplexArray()
+{
+  GetPoolState().complexArrays++;
+}
+
+ArrayPool::Statistics ArrayPool::GetStatistics()
+{
+  PoolState& state = GetPoolState();
+  Statistics statistics;
+  statistics.vtkArrays = state.vtkArrays;
+  statistics.complexArrays = state.complexArrays;
+  statistics.allocations = state.allocations;
+  statistics.reuses = state.reuses;
+  std::lock_guard<std::mutex> lock(state.mutex);
+  statistics.pooledBytes = state.pooledBytes;
+  return statistics;
+}
+
+void ArrayPool::ResetStatistics()
+{
+  PoolState& state = GetPoolState();
+  state.vtkArrays = 0;
+  state.complexArrays = 0;
+  state.allocations = 0;
+  state.reuses = 0;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @brief Selects what CV::Array::NewInstance() returns, i.e. what VTK filters get when
+ * they create output and temporary arrays from a wrapped input array. The default is
+ * ComplexArray, so filter outputs stay backed by complex data.
+ */
+enum class NewInstancePolicy
+{
+  /**
+   * @brief Opt-in: a plain VTK AOS array of the same value type. No complex objects are
+   * created, but filter outputs are no longer backed by complex data.
+   */
+  VtkArray,
+  /** @brief The default: a CV::Array over a new complex::DataArray with a complex::DataStore. */
+  ComplexArray,
+  /** @brief A CV::Array over a new complex::DataArray whose buffer comes from CV::ArrayPool. */
+  PooledComplexArray
+};
+
+/**
+ * @class CV::ArrayPool
+ * @brief The ArrayPool class holds the bridge-wide NewInstancePolicy and a pool of
+ * value buffers for CV::PooledDataStore. Buffers are grouped in power-of-two size
+ * classes, so arrays that VTK filters repeatedly create, grow and release reuse the
+ * same memory instead of going back to the allocator. Released buffers are kept until
+ * the pool exceeds its byte budget.
+ *
+ * It also counts the arrays created by CV::Array::NewInstance() and
+ * CV::Array::AllocateTuples() so that the cost of a pipeline can be inspected.
+ */
+class COMPLEX2VTKLIB_EXPORT ArrayPool
+{
+public:
+  /**
+   * @brief Counters since the last ResetStatistics() call.
+   */
+  struct Statistics
+  {
+    /** @brief Plain VTK arrays created by NewInstance() */
+    uint64_t vtkArrays = 0;
+    /** @brief complex::DataArrays created by CV::Array */
+    uint64_t complexArrays = 0;
+    /** @brief Buffers allocated by the pool */
+    uint64_t allocations = 0;
+    /** @brief Buffers handed out again from the pool */
+    uint64_t reuses = 0;
+    /** @brief Bytes currently held by the pool */
+    size_t pooledBytes = 0;
+  };
+
+  static constexpr size_t k_DefaultMaxPooledBytes = size_t(1) << 30;
+
+  ArrayPool() = delete;
+
+  /**
+   * @brief Sets the policy used by CV::Array::NewInstance(). The default is
+   * NewInstancePolicy::ComplexArray.
+   * @param policy
+   */
+  static void SetNewInstancePolicy(NewInstancePolicy policy);
+
+  /**
+   * @brief Returns the policy used by CV::Array::NewInstance().
+   * @return NewInstancePolicy
+   */
+  static NewInstancePolicy GetNewInstancePolicy();
+
+  /**
+   * @brief Returns a 64 byte aligned buffer of at least bytes bytes. On return bytes holds
+   * the actual capacity of the buffer, which must be passed back to Release().
+   * @param bytes
+   * @return void*
+   */
+  static void* Acquire(size_t& bytes);
+
+  /**
+   * @brief Returns a buffer obtained from Acquire() to the pool. The buffer is freed if
+   * the pool is full.
+   * @param buffer
+   * @param bytes Capacity returned by Acquire()
+   */
+  static void Release(void* buffer, size_t bytes);
+
+  /**
+   * @brief Frees all buffers held by the pool.
+   */
+  static void Trim();
+
+  /**
+   * @brief Sets the maximum number of bytes the pool keeps for reuse.
+   * @param maxBytes
+   */
+  static void SetMaxPooledBytes(size_t maxBytes);
+
+  /**
+   * @brief Returns the maximum number of bytes the pool keeps for reuse.
+   * @return size_t
+   */
+  static size_t GetMaxPooledBytes();
+
+  /**
+   * @brief Records that CV::Array created a plain VTK array.
+   */
+  static void CountVtkArray();
+
+  /**
+   * @brief Records that CV::Array created a complex::DataArray.
+   */
+  static void CountComplexArray();
+
+  /**
+   * @brief Returns the counters since the last ResetStatistics() call.
+   * @return Statistics
+   */
+  static Statistics GetStatistics();
+
+  /**
+   * @brief Resets the counters. Does not free pooled buffers.
+   */
+  static void ResetStatistics();
+};
+} // namespace CV
@@ -0,0 +1,265 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <vtkSMPThreadLocal.h>
+#include <vtkSMPTools.h>
+#include <vtkType.h>
+
+namespace CV
+{
+namespace Range
+{
+/**
+ * @brief Returns true if the value should be skipped when computing a range.
+ * NaN values are always skipped, infinite values only for finite ranges.
+ * @tparam FiniteOnly
+ * @tparam T
+ * @param value
+ * @return bool
+ */
+template <bool FiniteOnly, typename T>
+inline bool SkipValue(T value)
+{
+  if constexpr(std::is_floating_point_v<T>)
+  {
+    if constexpr(FiniteOnly)
+    {
+      return !std::isfinite(value);
+    }
+    else
+    {
+      return std::isnan(value);
+    }
+  }
+  else
+  {
+    return false;
+  }
+}
+
+/**
+ * @class CV::Range::ComponentMinMax
+ * @brief vtkSMPTools functor computing the per-component min/max of an array. Each
+ * thread reduces into its own range buffer, which are merged in Reduce().
+ * @tparam ArrayT
+ * @tparam FiniteOnly
+ */
+template <typename ArrayT, bool FiniteOnly>
+class ComponentMinMax
+{
+public:
+  using ValueType = typename ArrayT::ValueType;
+
+  ComponentMinMax(const ArrayT* array, double* ranges)
+  : m_Array(array)
+  , m_Ranges(ranges)
+  , m_NumComps(array->GetNumberOfComponents())
+  {
+  }
+
+  void Initialize()
+  {
+    LocalRange& local = m_ThreadRanges.Local();
+    local.values.resize(2 * m_NumComps);
+    for(int comp = 0; comp < m_NumComps; comp++)
+    {
+      local.values[2 * comp] = std::numeric_limits<ValueType>::max();
+      local.values[2 * comp + 1] = std::numeric_limits<ValueType>::lowest();
+    }
+    local.hasValues = false;
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    LocalRange& local = m_ThreadRanges.Local();
+    std::vector<ValueType>& localRange = local.values;
+    bool& hasValues = local.hasValues;
+    for(vtkIdType tupleIdx = begin; tupleIdx < end; tupleIdx++)
+    {
+      for(int comp = 0; comp < m_NumComps; comp++)
+      {
+        const ValueType value = m_Array->GetTypedComponent(tupleIdx, comp);
+        if(SkipValue<FiniteOnly>(value))
+        {
+          continue;
+        }
+        localRange[2 * comp] = value < localRange[2 * comp] ? value : localRange[2 * comp];
+        localRange[2 * comp + 1] = value > localRange[2 * comp + 1] ? value : localRange[2 * comp + 1];
+        hasValues = true;
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    for(int comp = 0; comp < m_NumComps; comp++)
+    {
+      m_Ranges[2 * comp] = VTK_DOUBLE_MAX;
+      m_Ranges[2 * comp + 1] = VTK_DOUBLE_MIN;
+    }
+    m_HasValues = false;
+
+    for(const LocalRange& local : m_ThreadRanges)
+    {
+      if(!local.hasValues)
+      {
+        continue;
+      }
+      const std::vector<ValueType>& localRange = local.values;
+      for(int comp = 0; comp < m_NumComps; comp++)
+      {
+        m_Ranges[2 * comp] = std::min(m_Ranges[2 * comp], static_cast<double>(localRange[2 * comp]));
+        m_Ranges[2 * comp + 1] = std::max(m_Ranges[2 * comp + 1], static_cast<double>(localRange[2 * comp + 1]));
+      }
+      m_HasValues = true;
+    }
+  }
+
+  /**
+   * @brief Returns true if at least one value contributed to the range.
+   * @return bool
+   */
+  bool hasValues() const
+  {
+    return m_HasValues;
+  }
+
+private:
+  struct LocalRange
+  {
+    std::vector<ValueType> values;
+    bool hasValues = false;
+  };
+
+  const ArrayT* m_Array = nullptr;
+  double* m_Ranges = nullptr;
+  int m_NumComps = 0;
+  bool m_HasValues = false;
+  vtkSMPThreadLocal<LocalRange> m_ThreadRanges;
+};
+
+/**
+ * @class CV::Range::MagnitudeMinMax
+ * @brief vtkSMPTools functor computing the min/max of the tuple L2 norms of an array.
+ * Squared norms are reduced and the square root is only taken on the final range.
+ * @tparam ArrayT
+ * @tparam FiniteOnly
+ */
+template <typename ArrayT, bool FiniteOnly>
+class MagnitudeMinMax
+{
+public:
+  using ValueType = typename ArrayT::ValueType;
+
+  MagnitudeMinMax(const ArrayT* array, double* range)
+  : m_Array(array)
+  , m_Range(range)
+  , m_NumComps(array->GetNumberOfComponents())
+  {
+  }
+
+  void Initialize()
+  {
+    std::array<double, 2>& localRange = m_ThreadRanges.Local();
+    localRange = {VTK_DOUBLE_MAX, VTK_DOUBLE_MIN};
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::array<double, 2>& localRange = m_ThreadRanges.Local();
+    for(vtkIdType tupleIdx = begin; tupleIdx < end; tupleIdx++)
+    {
+      double squaredNorm = 0.0;
+      bool skipTuple = false;
+      for(int comp = 0; comp < m_NumComps; comp++)
+      {
+        const ValueType value = m_Array->GetTypedComponent(tupleIdx, comp);
+        skipTuple |= SkipValue<FiniteOnly>(value);
+        const auto valueAsDouble = static_cast<double>(value);
+        squaredNorm += valueAsDouble * valueAsDouble;
+      }
+      if(skipTuple)
+      {
+        continue;
+      }
+      localRange[0] = std::min(localRange[0], squaredNorm);
+      localRange[1] = std::max(localRange[1], squaredNorm);
+    }
+  }
+
+  void Reduce()
+  {
+    m_Range[0] = VTK_DOUBLE_MAX;
+    m_Range[1] = VTK_DOUBLE_MIN;
+    for(const std::array<double, 2>& localRange : m_ThreadRanges)
+    {
+      m_Range[0] = std::min(m_Range[0], localRange[0]);
+      m_Range[1] = std::max(m_Range[1], localRange[1]);
+    }
+    m_HasValues = m_Range[0] <= m_Range[1];
+    if(m_HasValues)
+    {
+      m_Range[0] = std::sqrt(m_Range[0]);
+      m_Range[1] = std::sqrt(m_Range[1]);
+    }
+  }
+
+  /**
+   * @brief Returns true if at least one tuple contributed to the range.
+   * @return bool
+   */
+  bool hasValues() const
+  {
+    return m_HasValues;
+  }
+
+private:
+  const ArrayT* m_Array = nullptr;
+  double* m_Range = nullptr;
+  int m_NumComps = 0;
+  bool m_HasValues = false;
+  vtkSMPThreadLocal<std::array<double, 2>> m_ThreadRanges;
+};
+
+/**
+ * @brief Computes the per-component range of the array in parallel. ranges must
+ * hold 2 * NumberOfComponents values. Returns false if the array has no values
+ * that can contribute to the range.
+ * @tparam FiniteOnly
+ * @tparam ArrayT
+ * @param array
+ * @param ranges
+ * @return bool
+ */
+template <bool FiniteOnly, typename ArrayT>
+bool ComputeComponentRanges(const ArrayT* array, double* ranges)
+{
+  ComponentMinMax<ArrayT, FiniteOnly> functor(array, ranges);
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+  return functor.hasValues();
+}
+
+/**
+ * @brief Computes the range of the tuple magnitudes of the array in parallel.
+ * Returns false if the array has no tuples that can contribute to the range.
+ * @tparam FiniteOnly
+ * @tparam ArrayT
+ * @param array
+ * @param range
+ * @return bool
+ */
+template <bool FiniteOnly, typename ArrayT>
+bool ComputeMagnitudeRange(const ArrayT* array, double range[2])
+{
+  MagnitudeMinMax<ArrayT, FiniteOnly> functor(array, range);
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+  return functor.hasValues();
+}
+} // namespace Range
+} // namespace CV
@@ -0,0 +1,180 @@
+#include "CVCellArrayGeom.hpp"
+
+#include <vtkCellType.h>
+#include <vtkPolyData.h>
+#include <vtkUnstructuredGrid.h>
+
+#include "complex2VtkLib/VtkBridge/CVConnectivityArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVSharedSequences.hpp"
+#include "complex2VtkLib/VtkBridge/VtkBridge.hpp"
+
+using namespace CV;
+
+namespace
+{
+/**
+ * @brief Creates a vtkPolyData with the geometry's vertices as points. Returns nullptr
+ * if the vertex list cannot be wrapped.
+ * @param vertexList
+ * @return VTK_PTR(vtkPolyData)
+ */
+VTK_PTR(vtkPolyData) createPolyData(const complex::DataObject* vertexList)
+{
+  auto points = CV::VtkBridge::wrapVertexList(vertexList);
+  if(points == nullptr)
+  {
+    return nullptr;
+  }
+  VTK_NEW(vtkPolyData, polyData);
+  polyData->SetPoints(points);
+  return polyData;
+}
+
+/**
+ * @brief Creates a vtkUnstructuredGrid of cellType cells with the geometry's vertices as
+ * points. Returns nullptr if the vertex list cannot be wrapped.
+ * @param vertexList
+ * @param cells
+ * @param cellType
+ * @return VTK_PTR(vtkDataSet)
+ */
+VTK_PTR(vtkDataSet) createUnstructuredGrid(const complex::DataObject* vertexList, vtkCellArray* cells, int cellType)
+{
+  auto points = CV::VtkBridge::wrapVertexList(vertexList);
+  if(points == nullptr)
+  {
+    return nullptr;
+  }
+  VTK_NEW(vtkUnstructuredGrid, dataSet);
+  dataSet->SetPoints(points);
+  dataSet->SetCells(SharedSequences::GetCellTypes(cells->GetNumberOfCells(), cellType), cells);
+  return dataSet;
+}
+} // namespace
+
+VTK_PTR(vtkCellArray) CellArrayGeom::CreateCellArray(const std::shared_ptr<complex::DataArray<uint64_t>>& connectivity, int cellSize)
+{
+  if(connectivity == nullptr || cellSize <= 0 || connectivity->getNumberOfComponents() != static_cast<size_t>(cellSize))
+  {
+    return nullptr;
+  }
+  VTK_NEW(ConnectivityArray, connectivityArray);
+  if(!connectivityArray->SetConnectivity(connectivity))
+  {
+    return nullptr;
+  }
+
+  auto offsets = SharedSequences::GetOffsets(static_cast<vtkIdType>(connectivity->getNumberOfTuples()), cellSize);
+  VTK_NEW(vtkCellArray, cellArray);
+  cellArray->SetData(offsets, connectivityArray);
+  return cellArray;
+}
+
+VTK_PTR(vtkDataSet) CellArrayGeom::CreateFromGeom(const std::shared_ptr<complex::VertexGeom>& geom)
+{
+  if(geom == nullptr)
+  {
+    return nullptr;
+  }
+  auto polyData = createPolyData(geom->getVertices());
+  if(polyData == nullptr)
+  {
+    return nullptr;
+  }
+
+  // Vertex geometries have no connectivity list, so every point becomes its own cell.
+  // Both the connectivity 0, 1, 2, ... and the offsets alias the same shared sequence.
+  const vtkIdType numVerts = static_cast<vtkIdType>(geom->getNumberOfVertices());
+  VTK_NEW(vtkCellArray, verts);
+  verts->SetData(SharedSequences::GetOffsets(numVerts, 1), SharedSequences::GetSequence(numVerts, 1));
+  polyData->SetVerts(verts);
+  return polyData;
+}
+
+VTK_PTR(vtkDataSet) CellArrayGeom::CreateFromGeom(const std::shared_ptr<complex::EdgeGeom>& geom)
+{
+  if(geom == nullptr)
+  {
+    return nullptr;
+  }
+  auto lines = CreateCellArray(CV::VtkBridge::findConnectivityList(geom->getEdges()), 2);
+  if(lines == nullptr)
+  {
+    return nullptr;
+  }
+  auto polyData = createPolyData(geom->getVertices());
+  if(polyData == nullptr)
+  {
+    return nullptr;
+  }
+  polyData->SetLines(lines);
+  return polyData;
+}
+
+VTK_PTR(vtkDataSet) CellArrayGeom::CreateFromGeom(const std::shared_ptr<complex::TriangleGeom>& geom)
+{
+  if(geom == nullptr)
+  {
+    return nullptr;
+  }
+  auto polys = CreateCellArray(CV::VtkBridge::findConnectivityList(geom->getFaces()), 3);
+  if(polys == nullptr)
+  {
+    return nullptr;
+  }
+  auto polyData = createPolyData(geom->getVertices());
+  if(polyData == nullptr)
+  {
+    return nullptr;
+  }
+  polyData->SetPolys(polys);
+  return polyData;
+}
+
+VTK_PTR(vtkDataSet) CellArrayGeom::CreateFromGeom(const std::shared_ptr<complex::QuadGeom>& geom)
+{
+  if(geom == nullptr)
+  {
+    return nullptr;
+  }
+  auto polys = CreateCellArray(CV::VtkBridge::findConnectivityList(geom->getFaces()), 4);
+  if(polys == nullptr)
+  {
+    return nullptr;
+  }
+  auto polyData = createPolyData(geom->getVertices());
+  if(polyData == nullptr)
+  {
+    return nullptr;
+  }
+  polyData->SetPolys(polys);
+  return polyData;
+}
+
+VTK_PTR(vtkDataSet) CellArrayGeom::CreateFromGeom(const std::shared_ptr<complex::TetrahedralGeom>& geom)
+{
+  if(geom == nullptr)
+  {
+    return nullptr;
+  }
+  auto cells = CreateCellArray(CV::VtkBridge::findConnectivityList(geom->getTetrahedra()), 4);
+  if(cells == nullptr)
+  {
+    return nullptr;
+  }
+  return createUnstructuredGrid(geom->getVertices(), cells, VTK_TETRA);
+}
+
+VTK_PTR(vtkDataSet) CellArrayGeom::CreateFromGeom(const std::shared_ptr<complex::HexahedralGeom>& geom)
+{
+  if(geom == nullptr)
+  {
+    return nullptr;
+  }
+  auto cells = CreateCellArray(CV::VtkBridge::findConnectivityList(geom->getHexahedra()), 8);
+  if(cells == nullptr)
+  {
+    return nullptr;
+  }
+  return createUnstructuredGrid(geom->getVertices(), cells, VTK_HEXAHEDRON);
+}
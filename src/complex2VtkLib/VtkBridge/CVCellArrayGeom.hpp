@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <vtkCellArray.h>
+#include <vtkDataSet.h>
+
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/Geometry/EdgeGeom.hpp"
+#include "complex/DataStructure/Geometry/HexahedralGeom.hpp"
+#include "complex/DataStructure/Geometry/QuadGeom.hpp"
+#include "complex/DataStructure/Geometry/TetrahedralGeom.hpp"
+#include "complex/DataStructure/Geometry/TriangleGeom.hpp"
+#include "complex/DataStructure/Geometry/VertexGeom.hpp"
+
+#include "complex2VtkLib/VtkBridge/VtkMacros.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::CellArrayGeom
+ * @brief The CellArrayGeom class builds native VTK datasets for complex node geometries
+ * whose vtkCellArray connectivity aliases the complex uint64 connectivity list through
+ * CV::ConnectivityArray. Unlike the vtkMappedUnstructuredGrid wrappers, VTK filters
+ * read the cells straight from the vtkCellArray buffers instead of asking the
+ * implementation for every cell through virtual calls.
+ *
+ * Surface, edge and vertex geometries become vtkPolyData, tetrahedral and hexahedral
+ * geometries a vtkUnstructuredGrid. The points are the geometry's shared vertex list wrapped by
+ * CV::VtkBridge::wrapVertexList(). Offsets and cell types alias the process-wide
+ * buffers of CV::SharedSequences. Wrapping is therefore not constant-memory: the
+ * largest mesh of a cell size or type still needs its own offsets and cell types,
+ * 9 bytes per cell, while smaller meshes share them. The mapped wrappers
+ * (GeometryWrapMode::Mapped) need no per-cell memory beyond the connectivity.
+ *
+ * Each function returns nullptr if the geometry is null, its vertex list cannot be
+ * wrapped or its connectivity list is not backed by a contiguous store.
+ * CV::VtkBridge::wrapGeometry() then falls back to the vtkMappedUnstructuredGrid wrappers.
+ */
+class COMPLEX2VTKLIB_EXPORT CellArrayGeom
+{
+public:
+  CellArrayGeom() = delete;
+
+  /**
+   * @brief Creates a vtkPolyData with one vertex cell per vertex.
+   * @param geom
+   * @return VTK_PTR(vtkDataSet)
+   */
+  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<complex::VertexGeom>& geom);
+
+  /**
+   * @brief Creates a vtkPolyData whose lines alias the edge list.
+   * @param geom
+   * @return VTK_PTR(vtkDataSet)
+   */
+  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<complex::EdgeGeom>& geom);
+
+  /**
+   * @brief Creates a vtkPolyData whose polygons alias the triangle list.
+   * @param geom
+   * @return VTK_PTR(vtkDataSet)
+   */
+  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<complex::TriangleGeom>& geom);
+
+  /**
+   * @brief Creates a vtkPolyData whose polygons alias the quad list.
+   * @param geom
+   * @return VTK_PTR(vtkDataSet)
+   */
+  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<complex::QuadGeom>& geom);
+
+  /**
+   * @brief Creates a vtkUnstructuredGrid of VTK_TETRA cells that alias the tetrahedron list.
+   * @param geom
+   * @return VTK_PTR(vtkDataSet)
+   */
+  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<complex::TetrahedralGeom>& geom);
+
+  /**
+   * @brief Creates a vtkUnstructuredGrid of VTK_HEXAHEDRON cells that alias the hexahedron list.
+   * complex orders the points of a hexahedron like VTK, so no reordering is needed.
+   * @param geom
+   * @return VTK_PTR(vtkDataSet)
+   */
+  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<complex::HexahedralGeom>& geom);
+
+  /**
+   * @brief Creates a vtkCellArray of homogeneous cells with cellSize points each whose
+   * connectivity aliases the complex connectivity list. Returns nullptr if the list is
+   * not backed by a contiguous store or does not have cellSize components.
+   * @param connectivity
+   * @param cellSize
+   * @return VTK_PTR(vtkCellArray)
+   */
+  static VTK_PTR(vtkCellArray) CreateCellArray(const std::shared_ptr<complex::DataArray<uint64_t>>& connectivity, int cellSize);
+};
+} // namespace CV
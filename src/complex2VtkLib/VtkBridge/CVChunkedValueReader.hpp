@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+namespace CV
+{
+/**
+ * @class CV::ChunkedValueReader
+ * @brief Interface of read-only DataStores that load their values chunk by chunk, such
+ * as CV::Hdf5ChunkedDataStore. CV::Array finds it with a dynamic_cast to copy value
+ * ranges in bulk and to skip writing back to the store, without including the store's
+ * implementation and its HDF5 dependency.
+ * @tparam T
+ */
+template <class T>
+class ChunkedValueReader
+{
+public:
+  virtual ~ChunkedValueReader() = default;
+
+  /**
+   * @brief Copies the values [start, start + count) into output.
+   * @param start
+   * @param count
+   * @param output
+   */
+  virtual void copyValues(size_t start, size_t count, T* output) const = 0;
+};
+} // namespace CV
@@ -0,0 +1,238 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+#include "vtkDataArray.h"
+#include "vtkGenericDataArray.h"
+#include "vtkSetGet.h"
+
+#include "complex/DataStructure/AbstractDataStore.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVFixedSizeArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::ComponentView
+ * @brief The ComponentView class exposes a single component of a multi-component
+ * complex DataArray as a single-component vtkDataArray without copying. Values are
+ * read through a strided pointer into contiguous stores (see CV::IsContiguousStore). Other
+ * store types fall back to the virtual AbstractDataStore API.
+ *
+ * The view has a fixed size. Arrays created by VTK through NewInstance() are plain
+ * vtkAOSDataArrayTemplate<T> instances.
+ * @tparam T
+ */
+template <class T>
+class ComponentView : public CV::FixedSizeArray<CV::ComponentView<T>, T>
+{
+public:
+  using SelfType = CV::ComponentView<T>;
+  using ComplexArrayType = complex::DataArray<T>;
+  using ComplexArrayPointerType = std::shared_ptr<ComplexArrayType>;
+  using ValueType = T;
+  using Superclass2 = CV::FixedSizeArray<SelfType, T>;
+
+  vtkAbstractTypeMacroWithNewInstanceType(SelfType, Superclass2, vtkDataArray, typeid(SelfType).name());
+
+  /**
+   * @brief Creates a new instance of CV::ComponentView. This is required of vtkObject derived classes
+   * @return
+   */
+  static SelfType* New()
+  {
+    return new SelfType();
+  }
+
+  /**
+   * @brief Returns the name used for the view of the given component of the named array.
+   * @param arrayName
+   * @param component
+   * @return std::string
+   */
+  static std::string CreateViewName(const std::string& arrayName, int component)
+  {
+    return arrayName + "_" + std::to_string(component);
+  }
+
+  /**
+   * @brief
+   */
+  ComponentView()
+  : Superclass()
+  {
+    this->NumberOfComponents = 1;
+  }
+
+  /**
+   * @brief
+   * @param dataArr
+   * @param component
+   */
+  ComponentView(const ComplexArrayPointerType& dataArr, int component)
+  : Superclass()
+  {
+    SetComplexArray(dataArr, component);
+  }
+
+  ComponentView(const ComponentView&) = delete;
+  ComponentView(ComponentView&&) noexcept = delete;
+  ComponentView& operator=(const ComponentView&) = delete;
+  ComponentView& operator=(ComponentView&&) noexcept = delete;
+
+  virtual ~ComponentView() = default;
+
+  /**
+   * @brief Sets the viewed complex DataArray and component. The view is named
+   * "<ArrayName>_<component>".
+   * @param dataArray
+   * @param component
+   */
+  void SetComplexArray(const ComplexArrayPointerType& dataArray, int component)
+  {
+    m_DataArray = dataArray;
+    m_DataStore = nullptr;
+    m_RawData = nullptr;
+    m_Component = component;
+    m_Stride = 1;
+    this->NumberOfComponents = 1;
+    this->Size = 0;
+    this->MaxId = -1;
+    if(dataArray == nullptr)
+    {
+      return;
+    }
+
+    const auto numComps = static_cast<int>(dataArray->getNumberOfComponents());
+    if(component < 0 || component >= numComps)
+    {
+      throw std::runtime_error("CV::ComponentView::SetComplexArray() component index is out of range");
+    }
+
+    this->SetName(CreateViewName(dataArray->getName(), component).c_str());
+    m_Stride = numComps;
+    m_DataStore = dataArray->getDataStore();
+    if(ValueType* rawData = CV::GetContiguousData(m_DataStore))
+    {
+      m_RawData = rawData + component;
+    }
+    this->Size = static_cast<vtkIdType>(dataArray->getNumberOfTuples());
+    this->MaxId = this->Size - 1;
+  }
+
+  /**
+   * @brief Returns the viewed component index.
+   * @return int
+   */
+  int GetViewedComponent() const
+  {
+    return m_Component;
+  }
+
+  /**
+   * @brief Get the value at valueIdx.
+   * @param valueIdx
+   * @return T
+   */
+  inline ValueType GetValue(vtkIdType valueIdx) const
+  {
+    if(nullptr != m_RawData)
+    {
+      return m_RawData[valueIdx * m_Stride];
+    }
+    if(nullptr == m_DataStore)
+    {
+      throw std::runtime_error("CV::ComponentView::GetValue() does not have an underlying complex::DataArray");
+    }
+    return m_DataStore->getValue(valueIdx * m_Stride + m_Component);
+  }
+
+  /**
+   * @brief Set the value at valueIdx to value. This writes through to the viewed
+   * component of the complex DataArray.
+   * @param valueIdx
+   * @param value
+   */
+  inline void SetValue(vtkIdType valueIdx, ValueType value)
+  {
+    if(nullptr != m_RawData)
+    {
+      m_RawData[valueIdx * m_Stride] = value;
+      return;
+    }
+    if(nullptr == m_DataStore)
+    {
+      throw std::runtime_error("CV::ComponentView::SetValue() does not have an underlying complex::DataArray");
+    }
+    m_DataStore->setValue(valueIdx * m_Stride + m_Component, value);
+  }
+
+  /**
+   * @brief Copy the tuple at tupleIdx into tuple.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
+  {
+    tuple[0] = GetValue(tupleIdx);
+  }
+
+  /**
+   * @brief Set this array's tuple at tupleIdx to the values in tuple.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
+  {
+    SetValue(tupleIdx, tuple[0]);
+  }
+
+  /**
+   * @brief Get component compIdx of the tuple at tupleIdx. The view only has a single component.
+   * @param tupleIdx
+   * @param compIdx
+   * @return T
+   */
+  inline ValueType GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
+  {
+    return GetValue(tupleIdx);
+  }
+
+  /**
+   * @brief Set component compIdx of the tuple at tupleIdx to value. The view only has a single component.
+   * @param tupleIdx
+   * @param compIdx
+   * @param value
+   */
+  inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, ValueType value)
+  {
+    SetValue(tupleIdx, value);
+  }
+
+private:
+  friend class CV::FixedSizeArray<SelfType, T>;
+
+  ComplexArrayPointerType m_DataArray;
+  complex::AbstractDataStore<T>* m_DataStore = nullptr;
+  ValueType* m_RawData = nullptr;
+  int m_Component = 0;
+  vtkIdType m_Stride = 1;
+
+  /**
+   * @brief Returns the number of tuples of the viewed array, or -1 if none is set.
+   * Used by CV::FixedSizeArray to reject resizing.
+   * @return vtkIdType
+   */
+  vtkIdType getFixedNumberOfTuples() const
+  {
+    return m_DataArray != nullptr ? static_cast<vtkIdType>(m_DataArray->getNumberOfTuples()) : -1;
+  }
+};
+} // namespace CV
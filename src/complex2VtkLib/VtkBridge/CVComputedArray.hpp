@@ -0,0 +1,375 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "vtkDataArray.h"
+#include "vtkGenericDataArray.h"
+#include "vtkSetGet.h"
+
+#include "complex2VtkLib/VtkBridge/CVFixedSizeArray.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::ComputedArray
+ * @brief The ComputedArray class is a read-only vtkDataArray whose values are produced
+ * on demand by a user kernel, typically reading one or more wrapped complex arrays.
+ * Derived quantities such as magnitudes, colors or unit conversions can be shown in
+ * VTK without materializing them as new complex arrays.
+ *
+ * The kernel is evaluated for chunks of consecutive tuples. Evaluated chunks are kept
+ * in a least-recently-used cache bounded by SetMaxCachedChunks(), and every thread
+ * remembers the last chunk it read from, so sequential access only takes the cache
+ * lock once per chunk. Call Modified() after the kernel's inputs changed to drop the
+ * cached chunks.
+ * @tparam T
+ */
+template <class T>
+class ComputedArray : public CV::FixedSizeArray<CV::ComputedArray<T>, T>
+{
+public:
+  using SelfType = CV::ComputedArray<T>;
+  using ValueType = T;
+  using Superclass2 = CV::FixedSizeArray<SelfType, T>;
+
+  /**
+   * @brief Kernel computing the tuples [beginTuple, endTuple) into output, which holds
+   * (endTuple - beginTuple) * numComponents values in AOS order. The kernel may be
+   * called concurrently for different chunks.
+   */
+  using KernelType = std::function<void(vtkIdType beginTuple, vtkIdType endTuple, ValueType* output)>;
+
+  vtkAbstractTypeMacroWithNewInstanceType(SelfType, Superclass2, vtkDataArray, typeid(SelfType).name());
+
+  /**
+   * @brief Default size of a chunk in bytes. Chunks are sized to stay in the L2 cache
+   * while the kernel writes them.
+   */
+  static constexpr size_t k_DefaultChunkBytes = 256 * 1024;
+
+  /**
+   * @brief Default maximum number of cached chunks.
+   */
+  static constexpr size_t k_DefaultMaxCachedChunks = 64;
+
+  /**
+   * @brief Creates a new instance of CV::ComputedArray. This is required of vtkObject derived classes
+   * @return
+   */
+  static SelfType* New()
+  {
+    return new SelfType();
+  }
+
+  /**
+   * @brief
+   */
+  ComputedArray()
+  : Superclass()
+  {
+    resetCache();
+  }
+
+  /**
+   * @brief
+   * @param numTuples
+   * @param numComps
+   * @param kernel
+   */
+  ComputedArray(vtkIdType numTuples, int numComps, KernelType kernel)
+  : Superclass()
+  {
+    SetKernel(numTuples, numComps, std::move(kernel));
+  }
+
+  ComputedArray(const ComputedArray&) = delete;
+  ComputedArray(ComputedArray&&) noexcept = delete;
+  ComputedArray& operator=(const ComputedArray&) = delete;
+  ComputedArray& operator=(ComputedArray&&) noexcept = delete;
+
+  virtual ~ComputedArray() = default;
+
+  /**
+   * @brief Sets the kernel and the shape of the computed array. The chunk size is reset
+   * to the default for the new tuple size.
+   * @param numTuples
+   * @param numComps
+   * @param kernel
+   */
+  void SetKernel(vtkIdType numTuples, int numComps, KernelType kernel)
+  {
+    if(numComps < 1)
+    {
+      throw std::runtime_error("CV::ComputedArray::SetKernel() requires at least one component");
+    }
+    m_Kernel = std::move(kernel);
+    this->NumberOfComponents = numComps;
+    this->Size = numTuples * numComps;
+    this->MaxId = this->Size - 1;
+    m_ChunkTuples = std::max<vtkIdType>(1, static_cast<vtkIdType>(k_DefaultChunkBytes / (sizeof(ValueType) * numComps)));
+    this->Modified();
+  }
+
+  /**
+   * @brief Sets the number of tuples evaluated per kernel call.
+   * @param chunkTuples
+   */
+  void SetChunkSize(vtkIdType chunkTuples)
+  {
+    m_ChunkTuples = std::max<vtkIdType>(1, chunkTuples);
+    this->Modified();
+  }
+
+  /**
+   * @brief Returns the number of tuples evaluated per kernel call.
+   * @return vtkIdType
+   */
+  vtkIdType GetChunkSize() const
+  {
+    return m_ChunkTuples;
+  }
+
+  /**
+   * @brief Sets the maximum number of chunks kept in the cache. The cache holds at most
+   * maxChunks * GetChunkSize() tuples.
+   * @param maxChunks
+   */
+  void SetMaxCachedChunks(size_t maxChunks)
+  {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    m_MaxCachedChunks = std::max<size_t>(1, maxChunks);
+    evictChunks();
+  }
+
+  /**
+   * @brief Returns the maximum number of chunks kept in the cache.
+   * @return size_t
+   */
+  size_t GetMaxCachedChunks() const
+  {
+    return m_MaxCachedChunks;
+  }
+
+  /**
+   * @brief Drops all cached chunks in addition to updating the modification time.
+   * This must be called after the kernel's inputs changed.
+   */
+  void Modified() override
+  {
+    resetCache();
+    this->Superclass::Modified();
+  }
+
+  /**
+   * @brief Get the value at valueIdx.
+   * @param valueIdx assumes AOS ordering.
+   * @return T
+   */
+  inline ValueType GetValue(vtkIdType valueIdx) const
+  {
+    const vtkIdType tupleIdx = valueIdx / this->NumberOfComponents;
+    const vtkIdType chunkIdx = tupleIdx / m_ChunkTuples;
+    return chunkData(chunkIdx)[valueIdx - chunkIdx * m_ChunkTuples * this->NumberOfComponents];
+  }
+
+  /**
+   * @brief Computed arrays are read-only.
+   * @param valueIdx
+   * @param value
+   */
+  inline void SetValue(vtkIdType valueIdx, ValueType value)
+  {
+    vtkErrorMacro("CV::ComputedArray is read-only.");
+  }
+
+  /**
+   * @brief Copy the tuple at tupleIdx into tuple.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
+  {
+    const vtkIdType chunkIdx = tupleIdx / m_ChunkTuples;
+    const ValueType* source = chunkData(chunkIdx) + (tupleIdx - chunkIdx * m_ChunkTuples) * this->NumberOfComponents;
+    std::copy_n(source, this->NumberOfComponents, tuple);
+  }
+
+  /**
+   * @brief Computed arrays are read-only.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
+  {
+    vtkErrorMacro("CV::ComputedArray is read-only.");
+  }
+
+  /**
+   * @brief Get component compIdx of the tuple at tupleIdx.
+   * @param tupleIdx
+   * @param compIdx
+   * @return T
+   */
+  inline ValueType GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
+  {
+    const vtkIdType chunkIdx = tupleIdx / m_ChunkTuples;
+    return chunkData(chunkIdx)[(tupleIdx - chunkIdx * m_ChunkTuples) * this->NumberOfComponents + compIdx];
+  }
+
+  /**
+   * @brief Computed arrays are read-only.
+   * @param tupleIdx
+   * @param compIdx
+   * @param value
+   */
+  inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, ValueType value)
+  {
+    vtkErrorMacro("CV::ComputedArray is read-only.");
+  }
+
+private:
+  friend class CV::FixedSizeArray<SelfType, T>;
+
+  using ChunkType = std::shared_ptr<const std::vector<ValueType>>;
+  using LruListType = std::list<vtkIdType>;
+
+  struct CacheEntry
+  {
+    ChunkType chunk;
+    typename LruListType::iterator lruPosition;
+  };
+
+  /**
+   * @brief The chunk a thread read from last. The cache key changes every time the
+   * cache of any ComputedArray<T> is reset, so a stale entry never matches.
+   */
+  struct ThreadChunk
+  {
+    uint64_t cacheKey = 0;
+    vtkIdType chunkIdx = -1;
+    ChunkType chunk;
+  };
+
+  KernelType m_Kernel;
+  vtkIdType m_ChunkTuples = 1;
+  size_t m_MaxCachedChunks = k_DefaultMaxCachedChunks;
+  uint64_t m_CacheKey = 0;
+  mutable std::mutex m_CacheMutex;
+  mutable LruListType m_LruList;
+  mutable std::unordered_map<vtkIdType, CacheEntry> m_Chunks;
+
+  /**
+   * @brief Returns a key that is unique among all caches of this value type.
+   * @return uint64_t
+   */
+  static uint64_t nextCacheKey()
+  {
+    static std::atomic<uint64_t> s_CacheKey{0};
+    return ++s_CacheKey;
+  }
+
+  /**
+   * @brief Returns the values of the chunk, computing and caching it if needed.
+   * @param chunkIdx
+   * @return const ValueType*
+   */
+  const ValueType* chunkData(vtkIdType chunkIdx) const
+  {
+    static thread_local ThreadChunk s_ThreadChunk;
+    if(s_ThreadChunk.cacheKey != m_CacheKey || s_ThreadChunk.chunkIdx != chunkIdx)
+    {
+      s_ThreadChunk.chunk = findOrComputeChunk(chunkIdx);
+      s_ThreadChunk.chunkIdx = chunkIdx;
+      s_ThreadChunk.cacheKey = m_CacheKey;
+    }
+    return s_ThreadChunk.chunk->data();
+  }
+
+  /**
+   * @brief Returns the cached chunk or evaluates the kernel for it. The kernel runs
+   * without holding the cache lock so that chunks can be computed in parallel.
+   * @param chunkIdx
+   * @return ChunkType
+   */
+  ChunkType findOrComputeChunk(vtkIdType chunkIdx) const
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_CacheMutex);
+      auto iter = m_Chunks.find(chunkIdx);
+      if(iter != m_Chunks.end())
+      {
+        m_LruList.splice(m_LruList.begin(), m_LruList, iter->second.lruPosition);
+        return iter->second.chunk;
+      }
+    }
+
+    if(!m_Kernel)
+    {
+      throw std::runtime_error("CV::ComputedArray does not have a kernel");
+    }
+    const vtkIdType beginTuple = chunkIdx * m_ChunkTuples;
+    const vtkIdType endTuple = std::min(beginTuple + m_ChunkTuples, this->GetNumberOfTuples());
+    auto values = std::make_shared<std::vector<ValueType>>((endTuple - beginTuple) * this->NumberOfComponents);
+    m_Kernel(beginTuple, endTuple, values->data());
+
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    auto iter = m_Chunks.find(chunkIdx);
+    if(iter != m_Chunks.end())
+    {
+      // Another thread computed the same chunk in the meantime
+      return iter->second.chunk;
+    }
+    m_LruList.push_front(chunkIdx);
+    m_Chunks.emplace(chunkIdx, CacheEntry{values, m_LruList.begin()});
+    evictChunks();
+    return values;
+  }
+
+  /**
+   * @brief Removes the least recently used chunks until the cache fits. Chunks still
+   * referenced by a thread stay alive until that thread moves on. Requires m_CacheMutex.
+   */
+  void evictChunks() const
+  {
+    while(m_Chunks.size() > m_MaxCachedChunks)
+    {
+      m_Chunks.erase(m_LruList.back());
+      m_LruList.pop_back();
+    }
+  }
+
+  /**
+   * @brief Drops all cached chunks and invalidates the per-thread chunks.
+   */
+  void resetCache()
+  {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    m_Chunks.clear();
+    m_LruList.clear();
+    m_CacheKey = nextCacheKey();
+  }
+
+  /**
+   * @brief Returns the number of tuples of the computed shape.
+   * Used by CV::FixedSizeArray to reject resizing.
+   * @return vtkIdType
+   */
+  vtkIdType getFixedNumberOfTuples() const
+  {
+    return this->Size / this->NumberOfComponents;
+  }
+};
+} // namespace CV
@@ -0,0 +1,37 @@
+#include "CVConnectivityArray.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+
+using namespace CV;
+
+ConnectivityArray* ConnectivityArray::New()
+{
+  return new ConnectivityArray();
+}
+
+ConnectivityArray::ConnectivityArray()
+: vtkTypeInt64Array()
+{
+}
+
+ConnectivityArray::~ConnectivityArray() = default;
+
+bool ConnectivityArray::SetConnectivity(const std::shared_ptr<complex::DataArray<uint64_t>>& connectivity)
+{
+  uint64_t* data = connectivity == nullptr ? nullptr : CV::GetContiguousData(connectivity->getDataStore());
+  if(data == nullptr)
+  {
+    return false;
+  }
+
+  // save = 1 keeps VTK from freeing the complex buffer. m_Connectivity keeps it alive.
+  this->SetNumberOfComponents(1);
+  this->SetArray(reinterpret_cast<vtkTypeInt64*>(data), static_cast<vtkIdType>(connectivity->getSize()), 1);
+  m_Connectivity = connectivity;
+  return true;
+}
+
+const std::shared_ptr<complex::DataArray<uint64_t>>& ConnectivityArray::GetConnectivity() const
+{
+  return m_Connectivity;
+}
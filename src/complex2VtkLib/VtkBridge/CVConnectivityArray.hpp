@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <vtkTypeInt64Array.h>
+
+#include "complex/DataStructure/DataArray.hpp"
+
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::ConnectivityArray
+ * @brief The ConnectivityArray class is a vtkTypeInt64Array whose buffer aliases the
+ * values of a complex uint64 connectivity DataArray (e.g. a triangle or tetrahedron
+ * list) without copying them. It holds a std::shared_ptr to the DataArray so that the
+ * buffer outlives the DataStructure if needed.
+ *
+ * As a vtkTypeInt64Array it can be used directly as vtkCellArray connectivity. Point
+ * ids are reinterpreted as signed values, which is exact for ids below 2^63.
+ */
+class COMPLEX2VTKLIB_EXPORT ConnectivityArray : public vtkTypeInt64Array
+{
+public:
+  static ConnectivityArray* New();
+  vtkTypeMacro(ConnectivityArray, vtkTypeInt64Array);
+
+  /**
+   * @brief Aliases the values of the complex DataArray. The DataArray must be backed by a
+   * contiguous store (see CV::IsContiguousStore). Returns false otherwise.
+   * @param connectivity
+   * @return bool
+   */
+  bool SetConnectivity(const std::shared_ptr<complex::DataArray<uint64_t>>& connectivity);
+
+  /**
+   * @brief Returns the aliased complex DataArray.
+   * @return const std::shared_ptr<complex::DataArray<uint64_t>>&
+   */
+  const std::shared_ptr<complex::DataArray<uint64_t>>& GetConnectivity() const;
+
+protected:
+  /**
+   * @brief Default constructor
+   */
+  ConnectivityArray();
+  ~ConnectivityArray() override;
+
+private:
+  std::shared_ptr<complex::DataArray<uint64_t>> m_Connectivity;
+};
+} // namespace CV
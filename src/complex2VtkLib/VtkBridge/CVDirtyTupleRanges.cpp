@@ -0,0 +1,188 @@
+#include "CVDirtyTupleRanges.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+using namespace CV;
+
+namespace
+{
+/**
+ * @brief Trackers registered by CV::Array, keyed by the complex::IDataArray they track.
+ */
+struct Registry
+{
+  std::mutex mutex;
+  std::unordered_map<const complex::IDataArray*, std::weak_ptr<DirtyTupleRanges>> trackers;
+};
+
+Registry& GetRegistry()
+{
+  static Registry registry;
+  return registry;
+}
+} // namespace
+
+DirtyTupleRanges::DirtyTupleRanges(size_t numTuples, int blockShift)
+: m_BlockShift(blockShift)
+{
+  resize(numTuples);
+}
+
+DirtyTupleRanges::~DirtyTupleRanges() = default;
+
+void DirtyTupleRanges::markTuples(size_t begin, size_t end)
+{
+  end = std::min(end, m_NumTuples);
+  if(begin >= end)
+  {
+    return;
+  }
+  const size_t lastBlock = (end - 1) >> m_BlockShift;
+  for(size_t blockIdx = begin >> m_BlockShift; blockIdx <= lastBlock; blockIdx++)
+  {
+    m_Words[blockIdx >> 6].fetch_or(uint64_t(1) << (blockIdx & 63), std::memory_order_relaxed);
+  }
+}
+
+void DirtyTupleRanges::markAll()
+{
+  markTuples(0, m_NumTuples);
+}
+
+void DirtyTupleRanges::clear()
+{
+  for(size_t wordIdx = 0; wordIdx < m_NumWords; wordIdx++)
+  {
+    m_Words[wordIdx].store(0, std::memory_order_relaxed);
+  }
+}
+
+void DirtyTupleRanges::resize(size_t numTuples)
+{
+  const size_t numBlocks = (numTuples + getBlockSize() - 1) >> m_BlockShift;
+  const size_t numWords = (numBlocks + 63) / 64;
+  if(numWords != m_NumWords)
+  {
+    auto words = std::make_unique<std::atomic<uint64_t>[]>(numWords);
+    for(size_t wordIdx = 0; wordIdx < numWords; wordIdx++)
+    {
+      words[wordIdx].store(wordIdx < m_NumWords ? m_Words[wordIdx].load(std::memory_order_relaxed) : 0, std::memory_order_relaxed);
+    }
+    m_Words = std::move(words);
+    m_NumWords = numWords;
+  }
+
+  // Drop the marks of blocks that are no longer tracked
+  if(numBlocks < m_NumBlocks && (numBlocks & 63) != 0)
+  {
+    m_Words[numBlocks >> 6].fetch_and((uint64_t(1) << (numBlocks & 63)) - 1, std::memory_order_relaxed);
+  }
+  m_NumTuples = numTuples;
+  m_NumBlocks = numBlocks;
+}
+
+bool DirtyTupleRanges::isEmpty() const
+{
+  for(size_t wordIdx = 0; wordIdx < m_NumWords; wordIdx++)
+  {
+    if(m_Words[wordIdx].load(std::memory_order_relaxed) != 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<DirtyTupleRanges::RangeType> DirtyTupleRanges::getRanges() const
+{
+  std::vector<RangeType> ranges;
+  size_t blockIdx = 0;
+  while(blockIdx < m_NumBlocks)
+  {
+    // Skip clean words in one step
+    if((blockIdx & 63) == 0 && m_Words[blockIdx >> 6].load(std::memory_order_relaxed) == 0)
+    {
+      blockIdx += 64;
+      continue;
+    }
+    if(!isBlockDirty(blockIdx))
+    {
+      blockIdx++;
+      continue;
+    }
+    const size_t firstBlock = blockIdx;
+    while(blockIdx < m_NumBlocks && isBlockDirty(blockIdx))
+    {
+      blockIdx++;
+    }
+    ranges.emplace_back(firstBlock << m_BlockShift, std::min(blockIdx << m_BlockShift, m_NumTuples));
+  }
+  return ranges;
+}
+
+size_t DirtyTupleRanges::getNumberOfDirtyTuples() const
+{
+  size_t numTuples = 0;
+  for(const auto& range : getRanges())
+  {
+    numTuples += range.second - range.first;
+  }
+  return numTuples;
+}
+
+size_t DirtyTupleRanges::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+size_t DirtyTupleRanges::getBlockSize() const
+{
+  return size_t(1) << m_BlockShift;
+}
+
+bool DirtyTupleRanges::isBlockDirty(size_t blockIdx) const
+{
+  return (m_Words[blockIdx >> 6].load(std::memory_order_relaxed) >> (blockIdx & 63)) & 1;
+}
+
+std::shared_ptr<DirtyTupleRanges> DirtyTupleRanges::Find(const complex::IDataArray& dataArray)
+{
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto iter = registry.trackers.find(&dataArray);
+  if(iter == registry.trackers.end())
+  {
+    return nullptr;
+  }
+  auto tracker = iter->second.lock();
+  if(tracker == nullptr)
+  {
+    registry.trackers.erase(iter);
+  }
+  return tracker;
+}
+
+void DirtyTupleRanges::Register(const complex::IDataArray& dataArray, const std::shared_ptr<DirtyTupleRanges>& tracker)
+{
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.trackers[&dataArray] = tracker;
+}
+
+void DirtyTupleRanges::Unregister(const complex::IDataArray& dataArray, const DirtyTupleRanges* tracker)
+{
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto iter = registry.trackers.find(&dataArray);
+  if(iter == registry.trackers.end())
+  {
+    return;
+  }
+  auto registeredTracker = iter->second.lock();
+  if(registeredTracker == nullptr || registeredTracker.get() == tracker)
+  {
+    registry.trackers.erase(iter);
+  }
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "complex/DataStructure/IDataArray.hpp"
+
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::DirtyTupleRanges
+ * @brief The DirtyTupleRanges class records which tuples of an array were written. Tuples
+ * are grouped into blocks of 2^blockShift tuples and each block has one bit, so
+ * marking a tuple is a relaxed atomic load and, the first time only, an atomic OR.
+ * This keeps the hot path cheap and lets VTK filters write from several threads.
+ * getRanges() coalesces consecutive dirty blocks into half-open tuple ranges.
+ *
+ * CV::Array registers its tracker for the complex::IDataArray it wraps, so complex
+ * code can look it up with Find() without knowing about VTK.
+ */
+class COMPLEX2VTKLIB_EXPORT DirtyTupleRanges
+{
+public:
+  using RangeType = std::pair<size_t, size_t>;
+
+  static constexpr int k_DefaultBlockShift = 10;
+
+  /**
+   * @brief Creates a tracker for numTuples tuples with nothing marked.
+   * @param numTuples
+   * @param blockShift log2 of the number of tuples per block
+   */
+  explicit DirtyTupleRanges(size_t numTuples = 0, int blockShift = k_DefaultBlockShift);
+
+  DirtyTupleRanges(const DirtyTupleRanges&) = delete;
+  DirtyTupleRanges(DirtyTupleRanges&&) noexcept = delete;
+  DirtyTupleRanges& operator=(const DirtyTupleRanges&) = delete;
+  DirtyTupleRanges& operator=(DirtyTupleRanges&&) noexcept = delete;
+
+  ~DirtyTupleRanges();
+
+  /**
+   * @brief Marks the tuple as dirty. Tuples beyond the tracked size are ignored. Safe to
+   * call from several threads.
+   * @param tupleIdx
+   */
+  inline void markTuple(size_t tupleIdx)
+  {
+    const size_t blockIdx = tupleIdx >> m_BlockShift;
+    if(blockIdx >= m_NumBlocks)
+    {
+      return;
+    }
+    const uint64_t bit = uint64_t(1) << (blockIdx & 63);
+    std::atomic<uint64_t>& word = m_Words[blockIdx >> 6];
+    if((word.load(std::memory_order_relaxed) & bit) == 0)
+    {
+      word.fetch_or(bit, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief Marks the tuples [begin, end) as dirty.
+   * @param begin
+   * @param end
+   */
+  void markTuples(size_t begin, size_t end);
+
+  /**
+   * @brief Marks every tuple as dirty.
+   */
+  void markAll();
+
+  /**
+   * @brief Clears all marks.
+   */
+  void clear();
+
+  /**
+   * @brief Changes the number of tracked tuples. Marks of the remaining tuples are kept.
+   * Must not be called while other threads mark tuples.
+   * @param numTuples
+   */
+  void resize(size_t numTuples);
+
+  /**
+   * @brief Returns true if no tuple is marked.
+   * @return bool
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Returns the dirty tuples as sorted, non-overlapping, non-adjacent half-open
+   * ranges [first, second). Ranges are rounded out to whole blocks and clipped to the
+   * number of tuples.
+   * @return std::vector<RangeType>
+   */
+  std::vector<RangeType> getRanges() const;
+
+  /**
+   * @brief Returns the number of tuples covered by getRanges().
+   * @return size_t
+   */
+  size_t getNumberOfDirtyTuples() const;
+
+  /**
+   * @brief Returns the number of tracked tuples.
+   * @return size_t
+   */
+  size_t getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the number of tuples per block.
+   * @return size_t
+   */
+  size_t getBlockSize() const;
+
+  /**
+   * @brief Returns the tracker registered for dataArray or nullptr if its writes are not
+   * tracked.
+   * @param dataArray
+   * @return std::shared_ptr<DirtyTupleRanges>
+   */
+  static std::shared_ptr<DirtyTupleRanges> Find(const complex::IDataArray& dataArray);
+
+  /**
+   * @brief Registers tracker for dataArray, replacing any previous registration.
+   * @param dataArray
+   * @param tracker
+   */
+  static void Register(const complex::IDataArray& dataArray, const std::shared_ptr<DirtyTupleRanges>& tracker);
+
+  /**
+   * @brief Removes the registration of dataArray if it is tracker.
+   * @param dataArray
+   * @param tracker
+   */
+  static void Unregister(const complex::IDataArray& dataArray, const DirtyTupleRanges* tracker);
+
+private:
+  int m_BlockShift = k_DefaultBlockShift;
+  size_t m_NumTuples = 0;
+  size_t m_NumBlocks = 0;
+  size_t m_NumWords = 0;
+  std::unique_ptr<std::atomic<uint64_t>[]> m_Words;
+
+  /**
+   * @brief Returns true if the block is marked.
+   * @param blockIdx
+   * @return bool
+   */
+  bool isBlockDirty(size_t blockIdx) const;
+};
+} // namespace CV
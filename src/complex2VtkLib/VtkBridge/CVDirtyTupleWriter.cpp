@@ -0,0 +1,45 @@
+#include "CVDirtyTupleWriter.hpp"
+
+using namespace CV;
+
+Hdf5WritableFile::Hdf5WritableFile(const std::filesystem::path& filePath)
+: m_Hdf5Lock(Hdf5LibraryMutex())
+, m_ClosedUsers(FindHdf5FileUsers(filePath))
+{
+  for(Hdf5ReadOnlyFileUser* user : m_ClosedUsers)
+  {
+    user->closeHdf5File();
+  }
+  m_FileId = H5Fopen(filePath.string().c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+  if(m_FileId < 0)
+  {
+    reopenUsers();
+    throw std::runtime_error("CV::Hdf5WritableFile() could not open " + filePath.string() + " for writing");
+  }
+}
+
+Hdf5WritableFile::~Hdf5WritableFile()
+{
+  H5Fclose(m_FileId);
+  reopenUsers();
+}
+
+hid_t Hdf5WritableFile::getId() const
+{
+  return m_FileId;
+}
+
+void Hdf5WritableFile::reopenUsers()
+{
+  // A user that cannot be reopened reports the failure on its next read
+  for(Hdf5ReadOnlyFileUser* user : m_ClosedUsers)
+  {
+    try
+    {
+      user->reopenHdf5File();
+    } catch(const std::runtime_error&)
+    {
+    }
+  }
+  m_ClosedUsers.clear();
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <hdf5.h>
+
+#include "complex/DataStructure/DataArray.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVDirtyTupleRanges.hpp"
+#include "complex2VtkLib/VtkBridge/CVHdf5ChunkedDataStore.hpp"
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::Hdf5WritableFile
+ * @brief The Hdf5WritableFile class opens an HDF5 file for writing and holds
+ * CV::Hdf5LibraryMutex() while it is open. HDF5 cannot open a file for writing while
+ * the process has it open read-only, so the registered CV::Hdf5ReadOnlyFileUser
+ * instances of the file, e.g. CV::Hdf5ChunkedDataStore, are closed first and reopened
+ * when this object is destroyed. Reopened users drop the values they cached before.
+ */
+class COMPLEX2VTKLIB_EXPORT Hdf5WritableFile
+{
+public:
+  /**
+   * @brief Opens filePath for writing. Throws std::runtime_error if it cannot be opened.
+   * @param filePath
+   */
+  explicit Hdf5WritableFile(const std::filesystem::path& filePath);
+
+  Hdf5WritableFile(const Hdf5WritableFile&) = delete;
+  Hdf5WritableFile(Hdf5WritableFile&&) noexcept = delete;
+  Hdf5WritableFile& operator=(const Hdf5WritableFile&) = delete;
+  Hdf5WritableFile& operator=(Hdf5WritableFile&&) noexcept = delete;
+
+  /**
+   * @brief Closes the file and reopens the read-only users.
+   */
+  ~Hdf5WritableFile();
+
+  /**
+   * @brief Returns the HDF5 file id.
+   * @return hid_t
+   */
+  hid_t getId() const;
+
+private:
+  std::unique_lock<std::mutex> m_Hdf5Lock;
+  std::vector<Hdf5ReadOnlyFileUser*> m_ClosedUsers;
+  hid_t m_FileId = -1;
+
+  /**
+   * @brief Reopens the read-only users that were closed for writing.
+   */
+  void reopenUsers();
+};
+
+/**
+ * @brief Writes the dirty tuples of dataArray into an existing HDF5 dataset, e.g. the
+ * array's dataset in the .dream3d file it was read from, and clears dirtyRanges once
+ * all ranges are written. Each range is rounded out to whole rows of the dataset's
+ * slowest dimension and written with one hyperslab selection, so HDF5 only rewrites
+ * the chunks those rows touch. The file may be open read-only by
+ * CV::Hdf5ChunkedDataStore instances. dataArray must not be written while this runs.
+ * Throws std::runtime_error if the dataset cannot be opened or written or does not
+ * match the array; dirtyRanges is kept in that case.
+ * @tparam T
+ * @param dataArray
+ * @param dirtyRanges
+ * @param filePath
+ * @param datasetPath
+ * @return size_t Number of tuples written
+ */
+template <class T>
+size_t WriteDirtyTuples(const complex::DataArray<T>& dataArray, DirtyTupleRanges& dirtyRanges, const std::filesystem::path& filePath, const std::string& datasetPath)
+{
+  const std::vector<DirtyTupleRanges::RangeType> ranges = dirtyRanges.getRanges();
+  if(ranges.empty())
+  {
+    return 0;
+  }
+
+  Hdf5WritableFile file(filePath);
+  hid_t datasetId = H5Dopen2(file.getId(), datasetPath.c_str(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    throw std::runtime_error("CV::WriteDirtyTuples() could not open " + datasetPath + " in " + filePath.string());
+  }
+
+  hid_t fileSpace = H5Dget_space(datasetId);
+  auto closeDataset = [datasetId, fileSpace]() {
+    H5Sclose(fileSpace);
+    H5Dclose(datasetId);
+  };
+  const int rank = H5Sget_simple_extent_ndims(fileSpace);
+  std::vector<hsize_t> dims(std::max(rank, 0));
+  H5Sget_simple_extent_dims(fileSpace, dims.data(), nullptr);
+
+  const auto* dataStore = dataArray.getDataStore();
+  const size_t numTuples = dataStore->getNumberOfTuples();
+  const size_t numComps = dataStore->getNumberOfComponents();
+  hsize_t numValues = 1;
+  for(hsize_t dim : dims)
+  {
+    numValues *= dim;
+  }
+  if(dims.empty() || numValues != numTuples * numComps || numTuples % dims[0] != 0)
+  {
+    closeDataset();
+    throw std::runtime_error("CV::WriteDirtyTuples() " + datasetPath + " does not match " + dataArray.getName());
+  }
+
+  const size_t tuplesPerRow = numTuples / dims[0];
+  const T* contiguousData = CV::GetContiguousData(const_cast<complex::AbstractDataStore<T>*>(dataStore));
+  std::vector<T> buffer;
+  size_t numTuplesWritten = 0;
+  for(const auto& range : ranges)
+  {
+    const size_t firstRow = range.first / tuplesPerRow;
+    const size_t endRow = (range.second + tuplesPerRow - 1) / tuplesPerRow;
+    const size_t firstValue = firstRow * tuplesPerRow * numComps;
+    const size_t rangeValues = (endRow - firstRow) * tuplesPerRow * numComps;
+
+    const T* values = contiguousData != nullptr ? contiguousData + firstValue : nullptr;
+    if(values == nullptr)
+    {
+      buffer.resize(rangeValues);
+      for(size_t idx = 0; idx < rangeValues; idx++)
+      {
+        buffer[idx] = dataStore->getValue(firstValue + idx);
+      }
+      values = buffer.data();
+    }
+
+    std::vector<hsize_t> start(dims.size(), 0);
+    std::vector<hsize_t> count = dims;
+    start[0] = firstRow;
+    count[0] = endRow - firstRow;
+    H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr);
+    hid_t memSpace = H5Screate_simple(static_cast<int>(count.size()), count.data(), nullptr);
+    const herr_t error = H5Dwrite(datasetId, CV::NativeHdf5Type<T>(), memSpace, fileSpace, H5P_DEFAULT, values);
+    H5Sclose(memSpace);
+    if(error < 0)
+    {
+      closeDataset();
+      throw std::runtime_error("CV::WriteDirtyTuples() could not write " + datasetPath + " in " + filePath.string());
+    }
+    numTuplesWritten += (endRow - firstRow) * tuplesPerRow;
+  }
+
+  closeDataset();
+  dirtyRanges.clear();
+  return numTuplesWritten;
+}
+} // namespace CV
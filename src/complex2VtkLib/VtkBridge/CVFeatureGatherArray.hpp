@@ -0,0 +1,477 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+#include "vtkDataArray.h"
+#include "vtkGenericDataArray.h"
+#include "vtkIdList.h"
+#include "vtkSMPTools.h"
+#include "vtkSetGet.h"
+
+#include "complex/DataStructure/AbstractDataStore.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVFixedSizeArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::FeatureGatherArray
+ * @brief The FeatureGatherArray class presents a per-feature complex DataArray as a
+ * per-cell vtkDataArray through the cell's feature id. Tuple i of the array is tuple
+ * featureIds[i] of the feature array, so feature attributes can be shown as cell data
+ * without writing out a per-cell copy.
+ *
+ * Bulk reads through GetTuples() gather directly between the contiguous buffers of
+ * both complex arrays in a tight loop that the compiler can vectorize. The feature ids
+ * must all be valid tuple indices of the feature array, which HasValidFeatureIds()
+ * checks. GetTuples() checks the requested tuples and their feature ids and reports an
+ * error instead of reading out of range. The array is read-only and has a fixed size.
+ * @tparam T
+ */
+template <class T>
+class FeatureGatherArray : public CV::FixedSizeArray<CV::FeatureGatherArray<T>, T>
+{
+public:
+  using SelfType = CV::FeatureGatherArray<T>;
+  using ComplexArrayType = complex::DataArray<T>;
+  using ComplexArrayPointerType = std::shared_ptr<ComplexArrayType>;
+  using FeatureIdsArrayType = complex::DataArray<int32_t>;
+  using FeatureIdsArrayPointerType = std::shared_ptr<FeatureIdsArrayType>;
+  using ValueType = T;
+  using Superclass2 = CV::FixedSizeArray<SelfType, T>;
+
+  vtkAbstractTypeMacroWithNewInstanceType(SelfType, Superclass2, vtkDataArray, typeid(SelfType).name());
+
+  /**
+   * @brief Creates a new instance of CV::FeatureGatherArray. This is required of vtkObject derived classes
+   * @return
+   */
+  static SelfType* New()
+  {
+    return new SelfType();
+  }
+
+  /**
+   * @brief
+   */
+  FeatureGatherArray()
+  : Superclass()
+  {
+  }
+
+  /**
+   * @brief
+   * @param featureIds
+   * @param featureArray
+   */
+  FeatureGatherArray(const FeatureIdsArrayPointerType& featureIds, const ComplexArrayPointerType& featureArray)
+  : Superclass()
+  {
+    SetComplexArrays(featureIds, featureArray);
+  }
+
+  FeatureGatherArray(const FeatureGatherArray&) = delete;
+  FeatureGatherArray(FeatureGatherArray&&) noexcept = delete;
+  FeatureGatherArray& operator=(const FeatureGatherArray&) = delete;
+  FeatureGatherArray& operator=(FeatureGatherArray&&) noexcept = delete;
+
+  virtual ~FeatureGatherArray() = default;
+
+  /**
+   * @brief Sets the single-component per-cell feature ids and the per-feature array.
+   * The array takes the feature array's name and component count and the feature
+   * ids' tuple count.
+   * @param featureIds
+   * @param featureArray
+   */
+  void SetComplexArrays(const FeatureIdsArrayPointerType& featureIds, const ComplexArrayPointerType& featureArray)
+  {
+    if(featureIds == nullptr || featureArray == nullptr)
+    {
+      throw std::runtime_error("CV::FeatureGatherArray::SetComplexArrays() was given a null complex::DataArray");
+    }
+    if(featureIds->getNumberOfComponents() != 1)
+    {
+      throw std::runtime_error("CV::FeatureGatherArray::SetComplexArrays() requires single component feature ids");
+    }
+
+    m_FeatureIds = featureIds;
+    m_FeatureArray = featureArray;
+    m_FeatureIdsStore = featureIds->getDataStore();
+    m_FeatureStore = featureArray->getDataStore();
+    m_RawFeatureIds = CV::GetContiguousData(m_FeatureIdsStore);
+    m_RawFeatureData = CV::GetContiguousData(m_FeatureStore);
+
+    this->SetName(featureArray->getName().c_str());
+    this->NumberOfComponents = static_cast<int>(featureArray->getNumberOfComponents());
+    this->Size = static_cast<vtkIdType>(featureIds->getNumberOfTuples()) * this->NumberOfComponents;
+    this->MaxId = this->Size - 1;
+    this->Modified();
+  }
+
+  /**
+   * @brief Returns true if every feature id is a valid tuple index of the feature array.
+   * The feature ids are scanned in parallel.
+   * @return bool
+   */
+  bool HasValidFeatureIds() const
+  {
+    if(m_FeatureIds == nullptr)
+    {
+      return false;
+    }
+    std::atomic<bool> valid(true);
+    vtkSMPTools::For(0, this->GetNumberOfTuples(), [this, &valid](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType tupleIdx = begin; tupleIdx < end && valid.load(std::memory_order_relaxed); tupleIdx++)
+      {
+        if(!isValidFeatureId(featureId(tupleIdx)))
+        {
+          valid = false;
+        }
+      }
+    });
+    return valid;
+  }
+
+  /**
+   * @brief Get the value at valueIdx.
+   * @param valueIdx assumes AOS ordering.
+   * @return T
+   */
+  inline ValueType GetValue(vtkIdType valueIdx) const
+  {
+    const vtkIdType tupleIdx = valueIdx / this->NumberOfComponents;
+    return GetTypedComponent(tupleIdx, static_cast<int>(valueIdx - tupleIdx * this->NumberOfComponents));
+  }
+
+  /**
+   * @brief Gather arrays are read-only.
+   * @param valueIdx
+   * @param value
+   */
+  inline void SetValue(vtkIdType valueIdx, ValueType value)
+  {
+    vtkErrorMacro("CV::FeatureGatherArray is read-only.");
+  }
+
+  /**
+   * @brief Copy the tuple at tupleIdx into tuple.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
+  {
+    const vtkIdType featureValueIdx = featureId(tupleIdx) * this->NumberOfComponents;
+    for(int comp = 0; comp < this->NumberOfComponents; comp++)
+    {
+      tuple[comp] = featureValue(featureValueIdx + comp);
+    }
+  }
+
+  /**
+   * @brief Gather arrays are read-only.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
+  {
+    vtkErrorMacro("CV::FeatureGatherArray is read-only.");
+  }
+
+  /**
+   * @brief Get component compIdx of the tuple at tupleIdx.
+   * @param tupleIdx
+   * @param compIdx
+   * @return T
+   */
+  inline ValueType GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
+  {
+    return featureValue(featureId(tupleIdx) * this->NumberOfComponents + compIdx);
+  }
+
+  /**
+   * @brief Gather arrays are read-only.
+   * @param tupleIdx
+   * @param compIdx
+   * @param value
+   */
+  inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, ValueType value)
+  {
+    vtkErrorMacro("CV::FeatureGatherArray is read-only.");
+  }
+
+
+  /**
+   * @brief Copies the tuples p1 through p2 (inclusive) to the start of output. The
+   * output must already be large enough. Reports an error and leaves the affected
+   * output tuples unchanged if p1 through p2 is not a valid range or one of the
+   * feature ids is out of range.
+   * @param p1
+   * @param p2
+   * @param output
+   */
+  void GetTuples(vtkIdType p1, vtkIdType p2, vtkAbstractArray* output) override
+  {
+    const vtkIdType numTuples = p2 - p1 + 1;
+    if(numTuples <= 0 || p1 < 0 || p2 >= this->GetNumberOfTuples())
+    {
+      vtkErrorMacro("CV::FeatureGatherArray::GetTuples() was given the invalid tuple range [" << p1 << ", " << p2 << "]");
+      return;
+    }
+    ValueType* outputData = getContiguousOutput(output, numTuples);
+    if(outputData == nullptr)
+    {
+      if(checkedFeatureIds(p1, p2))
+      {
+        Superclass::GetTuples(p1, p2, output);
+      }
+      return;
+    }
+
+    // Each block checks its feature ids with a min/max pass first so that the gather
+    // loop itself stays free of branches.
+    std::atomic<bool> valid(true);
+    vtkSMPTools::For(0, numTuples, [this, p1, outputData, &valid](vtkIdType begin, vtkIdType end) {
+      const int32_t* ids = m_RawFeatureIds + p1 + begin;
+      if(!areValidFeatureIds(ids, end - begin))
+      {
+        valid = false;
+        return;
+      }
+      gather(ids, end - begin, outputData + begin * this->NumberOfComponents);
+    });
+    if(!valid)
+    {
+      vtkErrorMacro("CV::FeatureGatherArray::GetTuples() found feature ids outside of the " << featureCount() << " feature tuples");
+    }
+  }
+
+  /**
+   * @brief Copies the tuples listed in tupleIds to consecutive tuples of output. The
+   * output must already be large enough. Reports an error and leaves the affected
+   * output tuples unchanged if a tuple id or its feature id is out of range.
+   * @param tupleIds
+   * @param output
+   */
+  void GetTuples(vtkIdList* tupleIds, vtkAbstractArray* output) override
+  {
+    const vtkIdType numIds = tupleIds->GetNumberOfIds();
+    const vtkIdType numTuples = this->GetNumberOfTuples();
+    const vtkIdType numFeatures = featureCount();
+    const vtkIdType* idPtr = tupleIds->GetPointer(0);
+    ValueType* outputData = getContiguousOutput(output, numIds);
+    if(numIds == 0)
+    {
+      return;
+    }
+
+    std::atomic<bool> valid(true);
+    if(outputData == nullptr)
+    {
+      for(vtkIdType i = 0; i < numIds && valid; i++)
+      {
+        valid = idPtr[i] >= 0 && idPtr[i] < numTuples && isValidFeatureId(featureId(idPtr[i]));
+      }
+      if(valid)
+      {
+        Superclass::GetTuples(tupleIds, output);
+      }
+    }
+    else
+    {
+      const int numComps = this->NumberOfComponents;
+      vtkSMPTools::For(0, numIds, [this, idPtr, outputData, numComps, numTuples, numFeatures, &valid](vtkIdType begin, vtkIdType end) {
+        for(vtkIdType i = begin; i < end; i++)
+        {
+          const vtkIdType tupleIdx = idPtr[i];
+          const vtkIdType featureIdx = (tupleIdx >= 0 && tupleIdx < numTuples) ? static_cast<vtkIdType>(m_RawFeatureIds[tupleIdx]) : -1;
+          if(featureIdx < 0 || featureIdx >= numFeatures)
+          {
+            valid = false;
+            continue;
+          }
+          const ValueType* source = m_RawFeatureData + featureIdx * numComps;
+          for(int comp = 0; comp < numComps; comp++)
+          {
+            outputData[i * numComps + comp] = source[comp];
+          }
+        }
+      });
+    }
+    if(!valid)
+    {
+      vtkErrorMacro("CV::FeatureGatherArray::GetTuples() was given tuple ids outside of the " << numTuples << " tuples or with feature ids outside of the " << numFeatures << " feature tuples");
+    }
+  }
+
+private:
+  friend class CV::FixedSizeArray<SelfType, T>;
+
+  FeatureIdsArrayPointerType m_FeatureIds;
+  ComplexArrayPointerType m_FeatureArray;
+  complex::AbstractDataStore<int32_t>* m_FeatureIdsStore = nullptr;
+  complex::AbstractDataStore<T>* m_FeatureStore = nullptr;
+  const int32_t* m_RawFeatureIds = nullptr;
+  const ValueType* m_RawFeatureData = nullptr;
+
+  /**
+   * @brief Returns the feature id of the cell.
+   * @param tupleIdx
+   * @return vtkIdType
+   */
+  inline vtkIdType featureId(vtkIdType tupleIdx) const
+  {
+    if(nullptr != m_RawFeatureIds)
+    {
+      return m_RawFeatureIds[tupleIdx];
+    }
+    if(nullptr == m_FeatureIdsStore)
+    {
+      throw std::runtime_error("CV::FeatureGatherArray does not have underlying complex::DataArrays");
+    }
+    return m_FeatureIdsStore->getValue(tupleIdx);
+  }
+
+  /**
+   * @brief Returns the value at valueIdx of the feature array.
+   * @param valueIdx
+   * @return T
+   */
+  inline ValueType featureValue(vtkIdType valueIdx) const
+  {
+    if(nullptr != m_RawFeatureData)
+    {
+      return m_RawFeatureData[valueIdx];
+    }
+    return m_FeatureStore->getValue(valueIdx);
+  }
+
+  /**
+   * @brief Returns the number of tuples of the feature array.
+   * @return vtkIdType
+   */
+  inline vtkIdType featureCount() const
+  {
+    return m_FeatureArray == nullptr ? 0 : static_cast<vtkIdType>(m_FeatureArray->getNumberOfTuples());
+  }
+
+  /**
+   * @brief Returns true if featureIdx is a valid tuple index of the feature array.
+   * @param featureIdx
+   * @return bool
+   */
+  inline bool isValidFeatureId(vtkIdType featureIdx) const
+  {
+    return featureIdx >= 0 && featureIdx < featureCount();
+  }
+
+  /**
+   * @brief Returns true if all numIds feature ids are valid tuple indices of the
+   * feature array. The min/max loop vectorizes.
+   * @param ids
+   * @param numIds
+   * @return bool
+   */
+  bool areValidFeatureIds(const int32_t* ids, vtkIdType numIds) const
+  {
+    if(numIds <= 0)
+    {
+      return true;
+    }
+    int32_t minId = ids[0];
+    int32_t maxId = ids[0];
+    for(vtkIdType i = 1; i < numIds; i++)
+    {
+      minId = std::min(minId, ids[i]);
+      maxId = std::max(maxId, ids[i]);
+    }
+    return isValidFeatureId(minId) && isValidFeatureId(maxId);
+  }
+
+  /**
+   * @brief Returns true if the feature ids of the tuples p1 through p2 are valid and
+   * reports an error otherwise.
+   * @param p1
+   * @param p2
+   * @return bool
+   */
+  bool checkedFeatureIds(vtkIdType p1, vtkIdType p2)
+  {
+    for(vtkIdType tupleIdx = p1; tupleIdx <= p2; tupleIdx++)
+    {
+      if(!isValidFeatureId(featureId(tupleIdx)))
+      {
+        vtkErrorMacro("CV::FeatureGatherArray::GetTuples() found the feature id " << featureId(tupleIdx) << " of tuple " << tupleIdx << " outside of the " << featureCount() << " feature tuples");
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Gathers the feature tuples for numIds consecutive feature ids. Single component
+   * arrays use a separate loop without the component loop so that it vectorizes.
+   * @param ids
+   * @param numIds
+   * @param output
+   */
+  void gather(const int32_t* ids, vtkIdType numIds, ValueType* output) const
+  {
+    const ValueType* featureData = m_RawFeatureData;
+    const int numComps = this->NumberOfComponents;
+    if(numComps == 1)
+    {
+      for(vtkIdType i = 0; i < numIds; i++)
+      {
+        output[i] = featureData[ids[i]];
+      }
+      return;
+    }
+    for(vtkIdType i = 0; i < numIds; i++)
+    {
+      const ValueType* source = featureData + static_cast<vtkIdType>(ids[i]) * numComps;
+      for(int comp = 0; comp < numComps; comp++)
+      {
+        output[i * numComps + comp] = source[comp];
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the value buffer of output if both complex arrays are contiguous and
+   * output is a different contiguous array of the same type and shape that holds at
+   * least numTuples tuples. Otherwise returns nullptr.
+   * @param output
+   * @param numTuples
+   * @return ValueType*
+   */
+  ValueType* getContiguousOutput(vtkAbstractArray* output, vtkIdType numTuples) const
+  {
+    if(output == nullptr || output == this || m_RawFeatureIds == nullptr || m_RawFeatureData == nullptr || output->GetDataType() != this->GetDataType() || !output->HasStandardMemoryLayout() ||
+       output->GetNumberOfComponents() != this->NumberOfComponents || output->GetNumberOfTuples() < numTuples)
+    {
+      return nullptr;
+    }
+    return static_cast<ValueType*>(output->GetVoidPointer(0));
+  }
+
+  /**
+   * @brief Returns the number of feature ids, or -1 if none are set.
+   * Used by CV::FixedSizeArray to reject resizing.
+   * @return vtkIdType
+   */
+  vtkIdType getFixedNumberOfTuples() const
+  {
+    return m_FeatureIds != nullptr ? static_cast<vtkIdType>(m_FeatureIds->getNumberOfTuples()) : -1;
+  }
+};
+} // namespace CV
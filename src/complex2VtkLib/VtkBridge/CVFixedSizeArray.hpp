@@ -0,0 +1,93 @@
+#pragma once
+
+#include <typeinfo>
+
+#include "vtkDataArray.h"
+#include "vtkGenericDataArray.h"
+#include "vtkSetGet.h"
+
+namespace CV
+{
+/**
+ * @class CV::FixedSizeArray
+ * @brief The FixedSizeArray class is the common base of the vtkGenericDataArray wrappers
+ * that view complex data without owning a resizable buffer (CV::ComponentView,
+ * CV::SOAArray, CV::NeighborListArray, CV::ComputedArray, CV::FeatureGatherArray).
+ *
+ * AllocateTuples() and ReallocateTuples() only succeed if the requested number of tuples
+ * matches the wrapped data, as reported by DerivedT::getFixedNumberOfTuples(). VTK
+ * filters use NewInstance() to create writable, resizable output arrays, so
+ * NewInstance() returns plain vtkAOSDataArrayTemplate<T> instances typed as
+ * vtkDataArray.
+ *
+ * DerivedT must declare this class a friend if getFixedNumberOfTuples() is not public.
+ * @tparam DerivedT
+ * @tparam T
+ */
+template <class DerivedT, class T>
+class FixedSizeArray : public vtkGenericDataArray<DerivedT, T>
+{
+public:
+  using SelfType = CV::FixedSizeArray<DerivedT, T>;
+  using ValueType = T;
+  using Superclass2 = vtkGenericDataArray<DerivedT, T>;
+
+  // NewInstance() creates AOS arrays, so the typed NewInstance() returns a vtkDataArray.
+  vtkAbstractTypeMacroWithNewInstanceType(SelfType, Superclass2, vtkDataArray, typeid(SelfType).name());
+
+  /**
+   * @brief Fixed size arrays cannot be resized. Succeeds only if numTuples matches the wrapped data.
+   * @param numTuples
+   * @return bool
+   */
+  inline bool AllocateTuples(vtkIdType numTuples)
+  {
+    return checkFixedSize(numTuples);
+  }
+
+  /**
+   * @brief Fixed size arrays cannot be resized. Succeeds only if numTuples matches the wrapped data.
+   * @param numTuples
+   * @return bool
+   */
+  inline bool ReallocateTuples(vtkIdType numTuples)
+  {
+    return checkFixedSize(numTuples);
+  }
+
+protected:
+  FixedSizeArray() = default;
+  ~FixedSizeArray() override = default;
+
+  /**
+   * @brief VTK filters use NewInstance() to create output arrays, which must be
+   * writable and resizable. Those are created as plain AOS arrays of the same value type.
+   * @return vtkObjectBase*
+   */
+  vtkObjectBase* NewInstanceInternal() const override
+  {
+    return vtkDataArray::CreateDataArray(this->GetDataType());
+  }
+
+private:
+  /**
+   * @brief Returns true if numTuples matches the number of tuples of the wrapped data.
+   * DerivedT::getFixedNumberOfTuples() returns a negative value if no data is wrapped.
+   * @param numTuples
+   * @return bool
+   */
+  bool checkFixedSize(vtkIdType numTuples)
+  {
+    const vtkIdType fixedNumTuples = static_cast<const DerivedT*>(this)->getFixedNumberOfTuples();
+    if(fixedNumTuples >= 0 && fixedNumTuples == numTuples)
+    {
+      return true;
+    }
+    vtkErrorMacro(<< this->GetClassName() << " is a fixed size view of complex data and cannot be resized.");
+    return false;
+  }
+
+  FixedSizeArray(const FixedSizeArray&) = delete;
+  void operator=(const FixedSizeArray&) = delete;
+};
+} // namespace CV
@@ -0,0 +1,69 @@
+#include "CVHdf5ChunkedDataStore.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+using namespace CV;
+
+namespace
+{
+/**
+ * @brief Returns the key under which the users of filePath are registered.
+ * @param filePath
+ * @return std::string
+ */
+std::string FileUserKey(const std::filesystem::path& filePath)
+{
+  std::error_code errorCode;
+  std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(filePath, errorCode);
+  return (errorCode ? filePath.lexically_normal() : canonicalPath).string();
+}
+
+/**
+ * @brief Read-only users of HDF5 files, keyed by FileUserKey(). Guarded by
+ * CV::Hdf5LibraryMutex().
+ * @return std::unordered_multimap<std::string, Hdf5ReadOnlyFileUser*>&
+ */
+std::unordered_multimap<std::string, Hdf5ReadOnlyFileUser*>& FileUsers()
+{
+  static std::unordered_multimap<std::string, Hdf5ReadOnlyFileUser*> s_FileUsers;
+  return s_FileUsers;
+}
+} // namespace
+
+std::mutex& CV::Hdf5LibraryMutex()
+{
+  static std::mutex s_Hdf5Mutex;
+  return s_Hdf5Mutex;
+}
+
+bool CV::IsHdf5LibraryThreadSafe()
+{
+  static const bool s_ThreadSafe = []() {
+    hbool_t threadSafe = false;
+    return H5is_library_threadsafe(&threadSafe) >= 0 && threadSafe;
+  }();
+  return s_ThreadSafe;
+}
+
+void CV::RegisterHdf5FileUser(const std::filesystem::path& filePath, Hdf5ReadOnlyFileUser* user)
+{
+  FileUsers().emplace(FileUserKey(filePath), user);
+}
+
+void CV::UnregisterHdf5FileUser(Hdf5ReadOnlyFileUser* user)
+{
+  auto& fileUsers = FileUsers();
+  for(auto iter = fileUsers.begin(); iter != fileUsers.end();)
+  {
+    iter = iter->second == user ? fileUsers.erase(iter) : std::next(iter);
+  }
+}
+
+std::vector<Hdf5ReadOnlyFileUser*> CV::FindHdf5FileUsers(const std::filesystem::path& filePath)
+{
+  std::vector<Hdf5ReadOnlyFileUser*> users;
+  auto range = FileUsers().equal_range(FileUserKey(filePath));
+  std::transform(range.first, range.second, std::back_inserter(users), [](const auto& entry) { return entry.second; });
+  return users;
+}
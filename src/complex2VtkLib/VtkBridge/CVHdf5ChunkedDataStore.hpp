@@ -0,0 +1,863 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <hdf5.h>
+
+#include "complex/DataStructure/AbstractDataStore.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/Utilities/Parsing/HDF5/H5DatasetWriter.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVChunkedValueReader.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @brief Returns the process-wide mutex that serializes the HDF5 calls of the bridge.
+ * Unless the HDF5 library was built thread-safe, it must not be entered from several
+ * threads at once, so every bridge class that talks to HDF5 holds this mutex.
+ * @return std::mutex&
+ */
+COMPLEX2VTKLIB_EXPORT std::mutex& Hdf5LibraryMutex();
+
+/**
+ * @brief Returns true if the HDF5 library was built thread-safe.
+ * @return bool
+ */
+COMPLEX2VTKLIB_EXPORT bool IsHdf5LibraryThreadSafe();
+
+/**
+ * @class CV::Hdf5ReadOnlyFileUser
+ * @brief Interface of objects that keep an HDF5 file open read-only, such as
+ * CV::Hdf5ChunkedDataStore. HDF5 refuses to open a file for writing while the same
+ * process has it open read-only, so writers close the registered users of a file, write,
+ * and reopen them. Users are registered, looked up, closed and reopened with
+ * CV::Hdf5LibraryMutex() held.
+ */
+class COMPLEX2VTKLIB_EXPORT Hdf5ReadOnlyFileUser
+{
+public:
+  virtual ~Hdf5ReadOnlyFileUser() = default;
+
+  /**
+   * @brief Closes all HDF5 handles of the file.
+   */
+  virtual void closeHdf5File() = 0;
+
+  /**
+   * @brief Reopens the file read-only after closeHdf5File() and drops the values cached
+   * from before, since the file may have been written in between. Throws
+   * std::runtime_error if the file cannot be reopened.
+   */
+  virtual void reopenHdf5File() = 0;
+};
+
+/**
+ * @brief Registers user as holding filePath open read-only. Requires CV::Hdf5LibraryMutex().
+ * @param filePath
+ * @param user
+ */
+COMPLEX2VTKLIB_EXPORT void RegisterHdf5FileUser(const std::filesystem::path& filePath, Hdf5ReadOnlyFileUser* user);
+
+/**
+ * @brief Removes the registration of user. Requires CV::Hdf5LibraryMutex().
+ * @param user
+ */
+COMPLEX2VTKLIB_EXPORT void UnregisterHdf5FileUser(Hdf5ReadOnlyFileUser* user);
+
+/**
+ * @brief Returns the users registered for filePath. Requires CV::Hdf5LibraryMutex().
+ * @param filePath
+ * @return std::vector<Hdf5ReadOnlyFileUser*>
+ */
+COMPLEX2VTKLIB_EXPORT std::vector<Hdf5ReadOnlyFileUser*> FindHdf5FileUsers(const std::filesystem::path& filePath);
+
+/**
+ * @brief Returns the native HDF5 type matching T.
+ * @tparam T
+ * @return hid_t
+ */
+template <class T>
+hid_t NativeHdf5Type()
+{
+  if constexpr(std::is_same_v<T, int8_t>)
+  {
+    return H5T_NATIVE_INT8;
+  }
+  else if constexpr(std::is_same_v<T, int16_t>)
+  {
+    return H5T_NATIVE_INT16;
+  }
+  else if constexpr(std::is_same_v<T, int32_t>)
+  {
+    return H5T_NATIVE_INT32;
+  }
+  else if constexpr(std::is_same_v<T, int64_t>)
+  {
+    return H5T_NATIVE_INT64;
+  }
+  else if constexpr(std::is_same_v<T, uint8_t>)
+  {
+    return H5T_NATIVE_UINT8;
+  }
+  else if constexpr(std::is_same_v<T, uint16_t>)
+  {
+    return H5T_NATIVE_UINT16;
+  }
+  else if constexpr(std::is_same_v<T, uint32_t>)
+  {
+    return H5T_NATIVE_UINT32;
+  }
+  else if constexpr(std::is_same_v<T, uint64_t>)
+  {
+    return H5T_NATIVE_UINT64;
+  }
+  else if constexpr(std::is_same_v<T, float>)
+  {
+    return H5T_NATIVE_FLOAT;
+  }
+  else
+  {
+    static_assert(std::is_same_v<T, double>, "CV does not support HDF5 I/O for this value type");
+    return H5T_NATIVE_DOUBLE;
+  }
+}
+
+/**
+ * @class CV::Hdf5ChunkedDataStore
+ * @brief The Hdf5ChunkedDataStore class is a read-only complex data store that reads
+ * the values of an HDF5 dataset (e.g. an array in a .dream3d file) on demand. The
+ * dataset is split into chunks of whole rows along its slowest dimension, each read
+ * with a single hyperslab selection.
+ *
+ * Chunks are kept in a least-recently-used cache bounded by a byte budget. When chunks
+ * are requested in ascending order, the following chunks are read ahead on a background
+ * thread, one chunk at a time. Every thread remembers the last chunk it read from, so
+ * sequential access only takes the cache lock once per chunk.
+ *
+ * All HDF5 calls hold CV::Hdf5LibraryMutex(). Other code in the process may call HDF5
+ * without that mutex, so read-ahead is only enabled if the HDF5 library is thread-safe
+ * (see CV::IsHdf5LibraryThreadSafe()). The store registers itself as a
+ * CV::Hdf5ReadOnlyFileUser so that CV::WriteDirtyTuples() can write to the same file.
+ *
+ * operator[] and at() hand out references, which must outlive the cache. They pin the
+ * containing chunk until releasePinnedChunks() or the destruction of the store, so
+ * random access through them keeps every touched chunk in memory. Clearing the cache,
+ * e.g. after CV::WriteDirtyTuples(), does not invalidate references; later calls pin
+ * the new values. Prefer getValue() and copyValues(), which only go through the cache.
+ *
+ * Arrays larger than memory can be streamed through VTK this way. Writes are not
+ * supported: setValue(), the non-const operator[] and at() and reshapeTuples() throw.
+ * @tparam T
+ */
+template <class T>
+class Hdf5ChunkedDataStore final : public complex::AbstractDataStore<T>, public CV::ChunkedValueReader<T>, public CV::Hdf5ReadOnlyFileUser
+{
+public:
+  using value_type = typename complex::AbstractDataStore<T>::value_type;
+  using reference = typename complex::AbstractDataStore<T>::reference;
+  using const_reference = typename complex::AbstractDataStore<T>::const_reference;
+  using ShapeType = std::vector<size_t>;
+
+  /**
+   * @brief Default cache budget in bytes.
+   */
+  static constexpr size_t k_DefaultCacheBytes = 256 * 1024 * 1024;
+
+  /**
+   * @brief Default target size of a chunk in bytes.
+   */
+  static constexpr size_t k_DefaultChunkBytes = 4 * 1024 * 1024;
+
+  /**
+   * @brief Default number of chunks read ahead of sequential access if the HDF5 library
+   * is thread-safe.
+   */
+  static constexpr size_t k_DefaultPrefetchChunks = 2;
+
+  /**
+   * @brief Opens the dataset at datasetPath in the HDF5 file read-only. Throws
+   * std::runtime_error if the dataset cannot be opened or its number of values does
+   * not match the tuple and component shape.
+   * @param filePath
+   * @param datasetPath
+   * @param tupleShape
+   * @param componentShape
+   * @param cacheBytes
+   */
+  Hdf5ChunkedDataStore(const std::filesystem::path& filePath, const std::string& datasetPath, const ShapeType& tupleShape, const ShapeType& componentShape, size_t cacheBytes = k_DefaultCacheBytes)
+  : m_FilePath(filePath)
+  , m_DatasetPath(datasetPath)
+  , m_TupleShape(tupleShape)
+  , m_ComponentShape(componentShape)
+  , m_CacheBytes(cacheBytes)
+  , m_PrefetchChunks(IsHdf5LibraryThreadSafe() ? k_DefaultPrefetchChunks : 0)
+  , m_CacheKey(nextCacheKey())
+  {
+    std::lock_guard<std::mutex> hdf5Lock(Hdf5LibraryMutex());
+    reopenHdf5File();
+
+    hid_t fileSpace = H5Dget_space(m_DatasetId);
+    const int rank = H5Sget_simple_extent_ndims(fileSpace);
+    m_DatasetDims.resize(std::max(rank, 0));
+    H5Sget_simple_extent_dims(fileSpace, m_DatasetDims.data(), nullptr);
+    H5Sclose(fileSpace);
+
+    const auto numValues = std::accumulate(m_DatasetDims.cbegin(), m_DatasetDims.cend(), static_cast<hsize_t>(1), std::multiplies<>());
+    if(m_DatasetDims.empty() || numValues != getSize())
+    {
+      closeHdf5File();
+      throw std::runtime_error("CV::Hdf5ChunkedDataStore() " + datasetPath + " does not match the requested tuple and component shape");
+    }
+
+    m_ValuesPerRow = static_cast<size_t>(numValues / m_DatasetDims[0]);
+    setChunkBytes(k_DefaultChunkBytes);
+    RegisterHdf5FileUser(m_FilePath, this);
+  }
+
+  Hdf5ChunkedDataStore(const Hdf5ChunkedDataStore&) = delete;
+  Hdf5ChunkedDataStore(Hdf5ChunkedDataStore&&) noexcept = delete;
+  Hdf5ChunkedDataStore& operator=(const Hdf5ChunkedDataStore&) = delete;
+  Hdf5ChunkedDataStore& operator=(Hdf5ChunkedDataStore&&) noexcept = delete;
+
+  /**
+   * @brief Waits for outstanding read-ahead and closes the dataset.
+   */
+  ~Hdf5ChunkedDataStore() override
+  {
+    clearCache();
+    std::lock_guard<std::mutex> hdf5Lock(Hdf5LibraryMutex());
+    UnregisterHdf5FileUser(this);
+    closeHdf5File();
+  }
+
+  /**
+   * @brief Closes the dataset and the file. Requires CV::Hdf5LibraryMutex().
+   */
+  void closeHdf5File() override
+  {
+    if(m_DatasetId >= 0)
+    {
+      H5Dclose(m_DatasetId);
+      m_DatasetId = -1;
+    }
+    if(m_FileId >= 0)
+    {
+      H5Fclose(m_FileId);
+      m_FileId = -1;
+    }
+  }
+
+  /**
+   * @brief Opens the file read-only and the dataset, and drops the chunks read before.
+   * Requires CV::Hdf5LibraryMutex().
+   */
+  void reopenHdf5File() override
+  {
+    m_FileId = H5Fopen(m_FilePath.string().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if(m_FileId < 0)
+    {
+      throw std::runtime_error("CV::Hdf5ChunkedDataStore() could not open " + m_FilePath.string());
+    }
+    m_DatasetId = H5Dopen2(m_FileId, m_DatasetPath.c_str(), H5P_DEFAULT);
+    if(m_DatasetId < 0)
+    {
+      H5Fclose(m_FileId);
+      m_FileId = -1;
+      throw std::runtime_error("CV::Hdf5ChunkedDataStore() could not open " + m_DatasetPath + " in " + m_FilePath.string());
+    }
+    dropReadChunks();
+  }
+
+  /**
+   * @brief Sets the target size of a chunk in bytes. Chunks always hold whole rows of
+   * the dataset's slowest dimension. Drops all cached chunks.
+   * @param chunkBytes
+   */
+  void setChunkBytes(size_t chunkBytes)
+  {
+    clearCache();
+    const size_t rowBytes = m_ValuesPerRow * sizeof(T);
+    m_ChunkRows = std::max<size_t>(1, chunkBytes / std::max<size_t>(1, rowBytes));
+    m_ChunkValues = m_ChunkRows * m_ValuesPerRow;
+    m_NumChunks = (static_cast<size_t>(m_DatasetDims[0]) + m_ChunkRows - 1) / m_ChunkRows;
+  }
+
+  /**
+   * @brief Sets the maximum number of bytes held by cached chunks.
+   * @param cacheBytes
+   */
+  void setCacheBytes(size_t cacheBytes)
+  {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    m_CacheBytes = cacheBytes;
+    evictChunks();
+  }
+
+  /**
+   * @brief Returns the maximum number of bytes held by cached chunks.
+   * @return size_t
+   */
+  size_t getCacheBytes() const
+  {
+    return m_CacheBytes;
+  }
+
+  /**
+   * @brief Sets the number of chunks read ahead of sequential access. 0 disables read-ahead.
+   * Read-ahead is disabled by default unless the HDF5 library is thread-safe. Enabling it
+   * for a library that is not is only safe if no other code in the process calls HDF5
+   * while the store is read.
+   * @param numChunks
+   */
+  void setPrefetchChunks(size_t numChunks)
+  {
+    m_PrefetchChunks = numChunks;
+  }
+
+  /**
+   * @brief Returns the number of chunks read ahead of sequential access.
+   * @return size_t
+   */
+  size_t getPrefetchChunks() const
+  {
+    return m_PrefetchChunks;
+  }
+
+  /**
+   * @brief Returns the number of chunks read from the file so far, including read-ahead.
+   * @return size_t
+   */
+  size_t getNumberOfChunkReads() const
+  {
+    return m_ChunkReads;
+  }
+
+  /**
+   * @brief Returns the number of chunks pinned by operator[] and at() since the cache
+   * was last cleared.
+   * @return size_t
+   */
+  size_t getNumberOfPinnedChunks() const
+  {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    return m_PinnedChunks.size();
+  }
+
+  /**
+   * @brief Frees the chunks pinned by operator[] and at(). References returned by them
+   * become invalid. Must not overlap with other access.
+   */
+  void releasePinnedChunks()
+  {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    m_PinnedChunks.clear();
+    m_RetiredChunks.clear();
+    m_CacheKey = nextCacheKey();
+  }
+
+  /**
+   * @brief Returns the number of tuples in the store.
+   * @return size_t
+   */
+  size_t getNumberOfTuples() const override
+  {
+    return std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+  }
+
+  /**
+   * @brief Returns the tuple shape.
+   * @return const ShapeType&
+   */
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+
+  /**
+   * @brief Returns the number of components per tuple.
+   * @return size_t
+   */
+  size_t getNumberOfComponents() const override
+  {
+    return std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+  }
+
+  /**
+   * @brief Returns the component shape.
+   * @return const ShapeType&
+   */
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+
+  /**
+   * @brief The values live in the HDF5 file.
+   * @return complex::IDataStore::StoreType
+   */
+  complex::IDataStore::StoreType getStoreType() const override
+  {
+    return complex::IDataStore::StoreType::OutOfCore;
+  }
+
+  /**
+   * @brief The store is read-only. Throws std::runtime_error.
+   * @param tupleShape
+   */
+  void reshapeTuples(const ShapeType& tupleShape) override
+  {
+    throw std::runtime_error("CV::Hdf5ChunkedDataStore::reshapeTuples() the store is read-only");
+  }
+
+  /**
+   * @brief Returns the value at index.
+   * @param index
+   * @return value_type
+   */
+  value_type getValue(size_t index) const override
+  {
+    static thread_local ThreadChunk s_ThreadChunk;
+    const size_t chunkIdx = index / m_ChunkValues;
+    const uint64_t cacheKey = m_CacheKey.load(std::memory_order_relaxed);
+    if(s_ThreadChunk.cacheKey != cacheKey || s_ThreadChunk.chunkIdx != chunkIdx)
+    {
+      s_ThreadChunk.chunk = findOrReadChunk(chunkIdx);
+      s_ThreadChunk.chunkIdx = chunkIdx;
+      s_ThreadChunk.cacheKey = cacheKey;
+    }
+    return (*s_ThreadChunk.chunk)[index - chunkIdx * m_ChunkValues];
+  }
+
+  /**
+   * @brief The store is read-only. Throws std::runtime_error.
+   * @param index
+   * @param value
+   */
+  void setValue(size_t index, value_type value) override
+  {
+    throw std::runtime_error("CV::Hdf5ChunkedDataStore::setValue() the store is read-only");
+  }
+
+  /**
+   * @brief Returns a reference to the value at index. Pins the containing chunk, see
+   * the class documentation.
+   * @param index
+   * @return const_reference
+   */
+  const_reference operator[](size_t index) const override
+  {
+    static thread_local ThreadChunk s_PinnedChunk;
+    const size_t chunkIdx = index / m_ChunkValues;
+    const uint64_t cacheKey = m_CacheKey.load(std::memory_order_relaxed);
+    if(s_PinnedChunk.cacheKey != cacheKey || s_PinnedChunk.chunkIdx != chunkIdx)
+    {
+      s_PinnedChunk.chunk = pinChunk(chunkIdx);
+      s_PinnedChunk.chunkIdx = chunkIdx;
+      s_PinnedChunk.cacheKey = cacheKey;
+    }
+    return (*s_PinnedChunk.chunk)[index - chunkIdx * m_ChunkValues];
+  }
+
+  /**
+   * @brief The store is read-only. Throws std::runtime_error.
+   * @param index
+   * @return reference
+   */
+  reference operator[](size_t index) override
+  {
+    throw std::runtime_error("CV::Hdf5ChunkedDataStore::operator[]() the store is read-only");
+  }
+
+  /**
+   * @brief Returns a reference to the value at index. Pins the containing chunk, see
+   * the class documentation. Throws std::runtime_error if index is out of range.
+   * @param index
+   * @return const_reference
+   */
+  const_reference at(size_t index) const override
+  {
+    if(index >= getSize())
+    {
+      throw std::runtime_error("CV::Hdf5ChunkedDataStore::at() index is out of range");
+    }
+    return (*this)[index];
+  }
+
+  /**
+   * @brief The store is read-only. Throws std::runtime_error.
+   * @param index
+   * @return reference
+   */
+  reference at(size_t index) override
+  {
+    throw std::runtime_error("CV::Hdf5ChunkedDataStore::at() the store is read-only");
+  }
+
+  /**
+   * @brief Opens another read-only view of the same dataset with the same settings.
+   * @return std::unique_ptr<complex::IDataStore>
+   */
+  std::unique_ptr<complex::IDataStore> deepCopy() const override
+  {
+    auto copy = std::make_unique<Hdf5ChunkedDataStore>(m_FilePath, m_DatasetPath, m_TupleShape, m_ComponentShape, m_CacheBytes);
+    copy->setPrefetchChunks(m_PrefetchChunks);
+    return copy;
+  }
+
+  /**
+   * @brief Creates a writable in-memory complex::DataStore<T> with the same shape.
+   * @return std::unique_ptr<complex::IDataStore>
+   */
+  std::unique_ptr<complex::IDataStore> createNewInstance() const override
+  {
+    return std::make_unique<complex::DataStore<T>>(m_TupleShape, m_ComponentShape);
+  }
+
+  /**
+   * @brief Writes the values to HDF5 like a complex::DataStore<T>. The values are read
+   * into a temporary buffer first, so the array must fit into memory.
+   * @param datasetWriter
+   * @return complex::H5::ErrorType
+   */
+  complex::H5::ErrorType writeHdf5(complex::H5::DatasetWriter& datasetWriter) const override
+  {
+    std::vector<T> values(getSize());
+    copyValues(0, values.size(), values.data());
+    std::vector<hsize_t> dims;
+    std::copy(m_TupleShape.cbegin(), m_TupleShape.cend(), std::back_inserter(dims));
+    std::copy(m_ComponentShape.cbegin(), m_ComponentShape.cend(), std::back_inserter(dims));
+    return datasetWriter.writeSpan(dims, nonstd::span<const T>(values.data(), values.size()));
+  }
+
+  /**
+   * @brief Copies the values [start, start + count) into output chunk by chunk.
+   * @param start
+   * @param count
+   * @param output
+   */
+  void copyValues(size_t start, size_t count, T* output) const override
+  {
+    while(count > 0)
+    {
+      const size_t chunkIdx = start / m_ChunkValues;
+      const size_t offset = start - chunkIdx * m_ChunkValues;
+      ChunkType chunk = findOrReadChunk(chunkIdx);
+      const size_t numValues = std::min(count, chunk->size() - offset);
+      std::copy_n(chunk->data() + offset, numValues, output);
+      start += numValues;
+      output += numValues;
+      count -= numValues;
+    }
+  }
+
+private:
+  using ChunkType = std::shared_ptr<const std::vector<T>>;
+  using LruListType = std::list<size_t>;
+
+  struct CacheEntry
+  {
+    std::shared_future<ChunkType> chunk;
+    size_t bytes = 0;
+    typename LruListType::iterator lruPosition;
+  };
+
+  /**
+   * @brief The chunk a thread read from last. The cache key changes every time the
+   * cache of any Hdf5ChunkedDataStore<T> is cleared, so a stale entry never matches.
+   */
+  struct ThreadChunk
+  {
+    uint64_t cacheKey = 0;
+    size_t chunkIdx = 0;
+    ChunkType chunk;
+  };
+
+  std::filesystem::path m_FilePath;
+  std::string m_DatasetPath;
+  ShapeType m_TupleShape;
+  ShapeType m_ComponentShape;
+  std::vector<hsize_t> m_DatasetDims;
+  hid_t m_FileId = -1;
+  hid_t m_DatasetId = -1;
+  size_t m_ValuesPerRow = 1;
+  size_t m_ChunkRows = 1;
+  size_t m_ChunkValues = 1;
+  size_t m_NumChunks = 0;
+  size_t m_CacheBytes = k_DefaultCacheBytes;
+  size_t m_PrefetchChunks = k_DefaultPrefetchChunks;
+  std::atomic<uint64_t> m_CacheKey;
+  mutable std::atomic<size_t> m_ChunkReads{0};
+  mutable std::mutex m_CacheMutex;
+  mutable LruListType m_LruList;
+  mutable std::unordered_map<size_t, CacheEntry> m_Chunks;
+  mutable size_t m_CachedBytes = 0;
+  mutable std::unordered_map<size_t, ChunkType> m_PinnedChunks;
+  mutable std::vector<ChunkType> m_RetiredChunks;
+  mutable std::shared_future<ChunkType> m_Prefetch;
+  // The sentinel wraps around to 0 when incremented, so reading chunk 0 first counts as sequential
+  mutable size_t m_LastChunkIdx = std::numeric_limits<size_t>::max();
+
+  /**
+   * @brief Returns a key that is unique among all stores of this value type.
+   * @return uint64_t
+   */
+  static uint64_t nextCacheKey()
+  {
+    static std::atomic<uint64_t> s_CacheKey{0};
+    return ++s_CacheKey;
+  }
+
+  /**
+   * @brief Returns the total number of values.
+   * @return size_t
+   */
+  size_t getSize() const
+  {
+    return getNumberOfTuples() * getNumberOfComponents();
+  }
+
+  /**
+   * @brief Reads the rows of the chunk with a single hyperslab selection. The HDF5
+   * library is not assumed to be thread-safe, so reads hold CV::Hdf5LibraryMutex().
+   * @param chunkIdx
+   * @return ChunkType
+   */
+  ChunkType readChunk(size_t chunkIdx) const
+  {
+    const hsize_t firstRow = chunkIdx * m_ChunkRows;
+    const hsize_t numRows = std::min<hsize_t>(m_ChunkRows, m_DatasetDims[0] - firstRow);
+    auto values = std::make_shared<std::vector<T>>(numRows * m_ValuesPerRow);
+
+    std::vector<hsize_t> start(m_DatasetDims.size(), 0);
+    std::vector<hsize_t> count = m_DatasetDims;
+    start[0] = firstRow;
+    count[0] = numRows;
+
+    std::lock_guard<std::mutex> lock(Hdf5LibraryMutex());
+    if(m_DatasetId < 0)
+    {
+      throw std::runtime_error("CV::Hdf5ChunkedDataStore could not reopen " + m_DatasetPath + " in " + m_FilePath.string());
+    }
+    hid_t fileSpace = H5Dget_space(m_DatasetId);
+    H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr);
+    hid_t memSpace = H5Screate_simple(static_cast<int>(count.size()), count.data(), nullptr);
+    const herr_t error = H5Dread(m_DatasetId, NativeHdf5Type<T>(), memSpace, fileSpace, H5P_DEFAULT, values->data());
+    H5Sclose(memSpace);
+    H5Sclose(fileSpace);
+    if(error < 0)
+    {
+      throw std::runtime_error("CV::Hdf5ChunkedDataStore could not read " + m_DatasetPath + " from " + m_FilePath.string());
+    }
+    m_ChunkReads++;
+    return values;
+  }
+
+  /**
+   * @brief Returns the cached chunk or reads it. Ascending access reads the first
+   * uncached chunk of the read-ahead window on a background thread. At most one
+   * read-ahead is in flight per store, so sequential access never starts more than one
+   * extra thread. Chunks are read without holding the cache lock.
+   * @param chunkIdx
+   * @return ChunkType
+   */
+  ChunkType findOrReadChunk(size_t chunkIdx) const
+  {
+    std::shared_future<ChunkType> chunk;
+    {
+      std::lock_guard<std::mutex> lock(m_CacheMutex);
+      const bool sequential = chunkIdx == m_LastChunkIdx + 1;
+      m_LastChunkIdx = chunkIdx;
+      chunk = scheduleChunk(chunkIdx, std::launch::deferred);
+      const bool prefetchInFlight = m_Prefetch.valid() && m_Prefetch.wait_for(std::chrono::seconds(0)) == std::future_status::timeout;
+      if(sequential && !prefetchInFlight)
+      {
+        m_Prefetch = {};
+        for(size_t prefetchIdx = chunkIdx + 1; prefetchIdx <= chunkIdx + m_PrefetchChunks && prefetchIdx < m_NumChunks; prefetchIdx++)
+        {
+          if(m_Chunks.count(prefetchIdx) == 0)
+          {
+            m_Prefetch = scheduleChunk(prefetchIdx, std::launch::async);
+            break;
+          }
+        }
+      }
+      evictChunks();
+    }
+    return chunk.get();
+  }
+
+  /**
+   * @brief Returns the chunk pinned for operator[] and at(), reading it through the
+   * cache if it is not pinned yet.
+   * @param chunkIdx
+   * @return ChunkType
+   */
+  ChunkType pinChunk(size_t chunkIdx) const
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_CacheMutex);
+      auto iter = m_PinnedChunks.find(chunkIdx);
+      if(iter != m_PinnedChunks.end())
+      {
+        return iter->second;
+      }
+    }
+    ChunkType chunk = findOrReadChunk(chunkIdx);
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    // Another thread may have pinned the chunk in the meantime
+    return m_PinnedChunks.try_emplace(chunkIdx, std::move(chunk)).first->second;
+  }
+
+  /**
+   * @brief Moves the pinned chunks aside so that their references stay valid while
+   * later calls of operator[] and at() pin fresh chunks. Requires m_CacheMutex.
+   */
+  void retirePinnedChunks() const
+  {
+    for(auto& [chunkIdx, chunk] : m_PinnedChunks)
+    {
+      m_RetiredChunks.push_back(std::move(chunk));
+    }
+    m_PinnedChunks.clear();
+  }
+
+  /**
+   * @brief Returns the cache entry of the chunk, creating it with the given launch
+   * policy if the chunk is not cached yet. Requires m_CacheMutex.
+   * @param chunkIdx
+   * @param policy
+   * @return std::shared_future<ChunkType>
+   */
+  std::shared_future<ChunkType> scheduleChunk(size_t chunkIdx, std::launch policy) const
+  {
+    auto iter = m_Chunks.find(chunkIdx);
+    if(iter != m_Chunks.end())
+    {
+      m_LruList.splice(m_LruList.begin(), m_LruList, iter->second.lruPosition);
+      return iter->second.chunk;
+    }
+    const size_t firstRow = chunkIdx * m_ChunkRows;
+    const size_t bytes = std::min<size_t>(m_ChunkRows, m_DatasetDims[0] - firstRow) * m_ValuesPerRow * sizeof(T);
+    std::shared_future<ChunkType> chunk = std::async(policy, [this, chunkIdx]() { return readChunk(chunkIdx); }).share();
+    m_LruList.push_front(chunkIdx);
+    m_Chunks.emplace(chunkIdx, CacheEntry{chunk, bytes, m_LruList.begin()});
+    m_CachedBytes += bytes;
+    return chunk;
+  }
+
+  /**
+   * @brief Removes the least recently used chunks until the cache fits its budget. The
+   * most recently used chunk and chunks still being read ahead are kept. Chunks still
+   * referenced by a thread stay alive until that thread moves on. Requires m_CacheMutex.
+   */
+  void evictChunks() const
+  {
+    auto lruIter = m_LruList.end();
+    while(m_CachedBytes > m_CacheBytes && lruIter != m_LruList.begin() && std::prev(lruIter) != m_LruList.begin())
+    {
+      --lruIter;
+      auto entry = m_Chunks.find(*lruIter);
+      if(entry->second.chunk.wait_for(std::chrono::seconds(0)) == std::future_status::timeout)
+      {
+        continue;
+      }
+      m_CachedBytes -= entry->second.bytes;
+      m_Chunks.erase(entry);
+      lruIter = m_LruList.erase(lruIter);
+    }
+  }
+
+  /**
+   * @brief Drops all cached chunks after waiting for outstanding read-ahead, and
+   * invalidates the per-thread chunks.
+   */
+  void clearCache()
+  {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    for(auto& [chunkIdx, entry] : m_Chunks)
+    {
+      // Deferred reads that were never requested are dropped without running them
+      if(entry.chunk.wait_for(std::chrono::seconds(0)) == std::future_status::timeout)
+      {
+        entry.chunk.wait();
+      }
+    }
+    m_Chunks.clear();
+    m_LruList.clear();
+    m_CachedBytes = 0;
+    m_Prefetch = {};
+    retirePinnedChunks();
+    m_LastChunkIdx = std::numeric_limits<size_t>::max();
+    m_CacheKey = nextCacheKey();
+  }
+
+  /**
+   * @brief Drops the chunks that were read, and invalidates the per-thread chunks.
+   * Unlike clearCache() this does not wait for outstanding reads: the caller holds
+   * CV::Hdf5LibraryMutex(), which those reads still have to take, so they see the file
+   * as it is now and their entries are kept. Requires CV::Hdf5LibraryMutex().
+   */
+  void dropReadChunks()
+  {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    for(auto iter = m_Chunks.begin(); iter != m_Chunks.end();)
+    {
+      if(iter->second.chunk.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+      {
+        ++iter;
+        continue;
+      }
+      m_CachedBytes -= iter->second.bytes;
+      m_LruList.erase(iter->second.lruPosition);
+      iter = m_Chunks.erase(iter);
+    }
+    retirePinnedChunks();
+    m_LastChunkIdx = std::numeric_limits<size_t>::max();
+    m_CacheKey = nextCacheKey();
+  }
+};
+
+/**
+ * @brief Creates a complex DataArray in the DataStructure whose values are read on
+ * demand from the dataset at datasetPath in the HDF5 file at filePath, e.g. an array
+ * in a .dream3d file. Throws std::runtime_error if the dataset cannot be opened.
+ * @tparam T
+ * @param filePath
+ * @param datasetPath
+ * @param name
+ * @param dataStructure
+ * @param tupleShape
+ * @param componentShape
+ * @param parentId
+ * @return complex::DataArray<T>*
+ */
+template <class T>
+complex::DataArray<T>* CreateHdf5DataArray(const std::filesystem::path& filePath, const std::string& datasetPath, const std::string& name, complex::DataStructure& dataStructure,
+                                           const std::vector<size_t>& tupleShape, const std::vector<size_t>& componentShape, const std::optional<complex::DataObject::IdType>& parentId = {})
+{
+  auto dataStore = std::make_shared<Hdf5ChunkedDataStore<T>>(filePath, datasetPath, tupleShape, componentShape);
+  return complex::DataArray<T>::Create(dataStructure, name, dataStore, parentId);
+}
+} // namespace CV
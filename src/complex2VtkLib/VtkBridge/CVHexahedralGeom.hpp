@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+
+#include <vtkCellType.h>
+
+#include "complex/DataStructure/Geometry/HexahedralGeom.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVNodeGeomImpl.hpp"
+
+namespace CV
+{
+/**
+ * @brief Traits of complex's HexahedralGeom for CV::NodeGeomImpl. The cells are read from
+ * the geometry's hexahedron list. complex orders the points of a hexahedron like
+ * VTK_HEXAHEDRON: points 0-3 go counterclockwise around the bottom face seen from the
+ * top, and points 4-7 are the top face in the same order, so the point ids are passed
+ * through unchanged. complex's hexahedron faces, e.g. {0, 1, 5, 4} and {0, 3, 2, 1},
+ * follow the same convention.
+ */
+struct HexahedralGeomTraits
+{
+  using GeomType = complex::HexahedralGeom;
+
+  static constexpr int k_CellType = VTK_HEXAHEDRON;
+  static constexpr int k_NumVerts = 8;
+
+  /**
+   * @brief Returns the number of cells.
+   * @param geom
+   * @return size_t
+   */
+  static size_t GetNumberOfCells(complex::HexahedralGeom& geom)
+  {
+    return geom.getNumberOfElements();
+  }
+
+  /**
+   * @brief Returns the geometry's hexahedron list.
+   * @param geom
+   * @return std::shared_ptr<complex::UInt64Array>
+   */
+  static std::shared_ptr<complex::UInt64Array> GetConnectivity(complex::HexahedralGeom& geom)
+  {
+    return CV::VtkBridge::findConnectivityList(geom.getHexahedra());
+  }
+
+  /**
+   * @brief Writes the 8 point ids of the cell to verts.
+   * @param geom
+   * @param cellId
+   * @param verts
+   */
+  static void GetCellVerts(complex::HexahedralGeom& geom, size_t cellId, size_t* verts)
+  {
+    geom.getVertsAtHex(cellId, verts);
+  }
+};
+
+/**
+ * @brief vtkMappedUnstructuredGrid implementation for complex's HexahedralGeom.
+ */
+using HexahedralGeom = NodeGeomImpl<HexahedralGeomTraits>;
+
+/**
+ * @brief vtkMappedUnstructuredGrid over a complex HexahedralGeom.
+ */
+using CVHexahedralGrid = NodeGrid<HexahedralGeomTraits>;
+} // namespace CV
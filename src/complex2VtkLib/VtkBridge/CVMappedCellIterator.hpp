@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include <vtkCellIterator.h>
+#include <vtkCellType.h>
+#include <vtkIdList.h>
+#include <vtkMappedUnstructuredGrid.h>
+#include <vtkPoints.h>
+#include <vtkSmartPointer.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
+namespace CV
+{
+/**
+ * @class CV::MappedCellIterator
+ * @brief The MappedCellIterator class is the vtkCellIterator of the mapped grid
+ * wrappers (CVTriangleGrid, CVQuadGrid, ...). The default vtkMappedUnstructuredGrid
+ * iterator asks the implementation for the type and points of every cell. This
+ * iterator caches the cell type and, if the implementation's connectivity list is held
+ * in a contiguous store, walks it linearly, prefetching a few cells ahead. Point ids
+ * are copied straight into the vtkIdList, and coordinates are copied from the grid's
+ * point buffer if it is a contiguous float array.
+ *
+ * The implementation must provide the number of points per cell as the constexpr
+ * k_NumVerts, GetNumberOfCells(), GetCellType(), GetCellPoints() and
+ * GetConnectivityPointer(). If GetConnectivityPointer() returns nullptr, the point ids
+ * come from GetCellPoints(). The pointer and the number of cells are looked up again
+ * whenever the traversal is (re)started, so the connectivity must not be replaced or
+ * resized during one traversal.
+ * @tparam Implementation
+ */
+template <class Implementation>
+class MappedCellIterator : public vtkCellIterator
+{
+public:
+  using ImplementationType = Implementation;
+  using ThisType = MappedCellIterator<Implementation>;
+
+  static constexpr int k_CellSize = ImplementationType::k_NumVerts;
+
+  vtkTemplateTypeMacro(ThisType, vtkCellIterator);
+
+  static MappedCellIterator* New()
+  {
+    return new MappedCellIterator();
+  }
+
+  void PrintSelf(ostream& os, vtkIndent indent) override
+  {
+    this->Superclass::PrintSelf(os, indent);
+    os << indent << "CellId: " << m_CellId << endl;
+    os << indent << "NumberOfCells: " << m_NumberOfCells << endl;
+    os << indent << "CellSize: " << k_CellSize << endl;
+    os << indent << "RawConnectivity: " << (m_Connectivity != nullptr) << endl;
+    os << indent << "RawPoints: " << (m_PointCoords != nullptr) << endl;
+  }
+
+  /**
+   * @brief Sets the grid to iterate. Called by vtkMappedUnstructuredGrid::NewCellIterator().
+   * @param grid
+   */
+  void SetMappedUnstructuredGrid(vtkMappedUnstructuredGrid<ImplementationType, ThisType>* grid)
+  {
+    m_Impl = grid->GetImplementation();
+    updateConnectivity();
+
+    m_GridPoints = grid->GetPoints();
+    m_PointCoords = nullptr;
+    if(m_GridPoints != nullptr)
+    {
+      vtkDataArray* pointData = m_GridPoints->GetData();
+      if(pointData->GetDataType() == VTK_FLOAT && pointData->GetNumberOfComponents() == 3 && pointData->HasStandardMemoryLayout())
+      {
+        m_PointCoords = static_cast<const float*>(pointData->GetVoidPointer(0));
+      }
+    }
+  }
+
+  bool IsDoneWithTraversal() override
+  {
+    return m_CellId >= m_NumberOfCells;
+  }
+
+  vtkIdType GetCellId() override
+  {
+    return m_CellId;
+  }
+
+protected:
+  /**
+   * @brief Number of cells whose connectivity is prefetched ahead of the current cell.
+   */
+  static constexpr vtkIdType k_PrefetchDistance = 16;
+
+  MappedCellIterator() = default;
+  ~MappedCellIterator() override = default;
+
+  void ResetToFirstCell() override
+  {
+    updateConnectivity();
+  }
+
+  void IncrementToNextCell() override
+  {
+    m_CellId++;
+  }
+
+  void FetchCellType() override
+  {
+    this->CellType = m_CellType;
+  }
+
+  void FetchPointIds() override
+  {
+    if(m_Connectivity == nullptr)
+    {
+      m_Impl->GetCellPoints(m_CellId, this->PointIds);
+      return;
+    }
+
+    if(m_CellId + k_PrefetchDistance < m_NumberOfCells)
+    {
+      prefetch(m_Connectivity + (m_CellId + k_PrefetchDistance) * k_CellSize);
+    }
+    const uint64_t* cellPoints = m_Connectivity + m_CellId * k_CellSize;
+    this->PointIds->SetNumberOfIds(k_CellSize);
+    vtkIdType* ptIds = this->PointIds->GetPointer(0);
+    for(int i = 0; i < k_CellSize; i++)
+    {
+      ptIds[i] = static_cast<vtkIdType>(cellPoints[i]);
+    }
+  }
+
+  void FetchPoints() override
+  {
+    vtkIdList* ptIds = this->GetPointIds();
+    if(m_PointCoords == nullptr || this->Points->GetDataType() != VTK_FLOAT)
+    {
+      m_GridPoints->GetPoints(ptIds, this->Points);
+      return;
+    }
+
+    const vtkIdType numIds = ptIds->GetNumberOfIds();
+    this->Points->SetNumberOfPoints(numIds);
+    auto* coords = static_cast<float*>(this->Points->GetVoidPointer(0));
+    const vtkIdType* ids = ptIds->GetPointer(0);
+    for(vtkIdType i = 0; i < numIds; i++)
+    {
+      std::memcpy(coords + 3 * i, m_PointCoords + 3 * ids[i], 3 * sizeof(float));
+    }
+  }
+
+private:
+  vtkSmartPointer<ImplementationType> m_Impl;
+  vtkSmartPointer<vtkPoints> m_GridPoints;
+  const uint64_t* m_Connectivity = nullptr;
+  const float* m_PointCoords = nullptr;
+  vtkIdType m_CellId = 0;
+  vtkIdType m_NumberOfCells = 0;
+  int m_CellType = VTK_EMPTY_CELL;
+
+  /**
+   * @brief Rewinds to the first cell and looks up the number of cells, the cell type
+   * and the raw connectivity of the implementation again.
+   */
+  void updateConnectivity()
+  {
+    m_CellId = 0;
+    m_NumberOfCells = m_Impl == nullptr ? 0 : m_Impl->GetNumberOfCells();
+    m_CellType = m_NumberOfCells > 0 ? m_Impl->GetCellType(0) : VTK_EMPTY_CELL;
+    m_Connectivity = m_NumberOfCells > 0 ? m_Impl->GetConnectivityPointer() : nullptr;
+  }
+
+  /**
+   * @brief Hints the CPU to load the cache line at address.
+   * @param address
+   */
+  static void prefetch(const void* address)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(_MSC_VER)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#endif
+  }
+
+  MappedCellIterator(const MappedCellIterator&) = delete;
+  void operator=(const MappedCellIterator&) = delete;
+};
+} // namespace CV
@@ -0,0 +1,370 @@
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "complex/DataStructure/AbstractDataStore.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/Utilities/Parsing/HDF5/H5DatasetWriter.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVMappedFile.hpp"
+#include "complex2VtkLib/VtkBridge/CVPooledDataStore.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::MappedDataStore
+ * @brief The MappedDataStore class is a complex data store whose values live in a
+ * memory mapped raw binary file. Nothing is read until a page is first accessed. The
+ * values are stored in the file in native byte order with the components of each
+ * tuple next to each other.
+ *
+ * By default the file is mapped copy-on-write through CV::MappedFile and is never
+ * modified: setValue() and writes through the raw pointer only change private copies
+ * of the touched pages, and those changes are lost when the store is destroyed. Stores
+ * created writable map the file shared, so writes reach the file; call flush() to
+ * write them back at a defined point.
+ *
+ * The mapping is contiguous, so CV::Array and the other bridge arrays access it
+ * through a raw pointer just like a complex::DataStore<T>.
+ * @tparam T
+ */
+template <class T>
+class MappedDataStore : public complex::AbstractDataStore<T>
+{
+public:
+  using value_type = typename complex::AbstractDataStore<T>::value_type;
+  using reference = typename complex::AbstractDataStore<T>::reference;
+  using const_reference = typename complex::AbstractDataStore<T>::const_reference;
+  using ShapeType = std::vector<size_t>;
+
+  /**
+   * @brief Maps the file at filePath. Throws std::runtime_error if the file cannot be
+   * mapped or is smaller than the given tuple and component shape.
+   * @param filePath
+   * @param tupleShape
+   * @param componentShape
+   * @param writable If true, writes to the store reach the file.
+   */
+  MappedDataStore(const std::filesystem::path& filePath, const ShapeType& tupleShape, const ShapeType& componentShape, bool writable = false)
+  : m_File(MappedFile::Open(filePath, writable))
+  , m_TupleShape(tupleShape)
+  , m_ComponentShape(componentShape)
+  {
+    if(m_File->size() < getSize() * sizeof(T))
+    {
+      throw std::runtime_error("CV::MappedDataStore() " + filePath.string() + " is smaller than the requested tuple and component shape");
+    }
+    m_Data = static_cast<T*>(m_File->data());
+  }
+
+  MappedDataStore(const MappedDataStore&) = delete;
+  MappedDataStore(MappedDataStore&&) noexcept = delete;
+  MappedDataStore& operator=(const MappedDataStore&) = delete;
+  MappedDataStore& operator=(MappedDataStore&&) noexcept = delete;
+
+  ~MappedDataStore() override = default;
+
+  /**
+   * @brief Returns the number of tuples in the store.
+   * @return size_t
+   */
+  size_t getNumberOfTuples() const override
+  {
+    return std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+  }
+
+  /**
+   * @brief Returns the tuple shape.
+   * @return const ShapeType&
+   */
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+
+  /**
+   * @brief Returns the number of components per tuple.
+   * @return size_t
+   */
+  size_t getNumberOfComponents() const override
+  {
+    return std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+  }
+
+  /**
+   * @brief Returns the component shape.
+   * @return const ShapeType&
+   */
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+
+  /**
+   * @brief The values live in the mapped file, not in memory owned by the store.
+   * @return complex::IDataStore::StoreType
+   */
+  complex::IDataStore::StoreType getStoreType() const override
+  {
+    return complex::IDataStore::StoreType::OutOfCore;
+  }
+
+  /**
+   * @brief Returns true if writes to the store reach the file.
+   * @return bool
+   */
+  bool isWritable() const
+  {
+    return m_File->isWritable();
+  }
+
+  /**
+   * @brief Writes the modified values of a writable store back to the file. Does
+   * nothing for copy-on-write stores. See CV::MappedFile::flush().
+   */
+  void flush() const
+  {
+    m_File->flush();
+  }
+
+  /**
+   * @brief Changes the tuple shape. The mapping cannot grow, so this throws if the new
+   * shape needs more values than the file holds.
+   * @param tupleShape
+   */
+  void reshapeTuples(const ShapeType& tupleShape) override
+  {
+    const size_t numTuples = std::accumulate(tupleShape.cbegin(), tupleShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+    if(numTuples * getNumberOfComponents() * sizeof(T) > m_File->size())
+    {
+      throw std::runtime_error("CV::MappedDataStore::reshapeTuples() cannot grow beyond the size of " + m_File->path().string());
+    }
+    m_TupleShape = tupleShape;
+  }
+
+  /**
+   * @brief Returns the value at index.
+   * @param index
+   * @return value_type
+   */
+  value_type getValue(size_t index) const override
+  {
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Sets the value at index. Copy-on-write stores only change the private copy
+   * of the page, writable stores the file.
+   * @param index
+   * @param value
+   */
+  void setValue(size_t index, value_type value) override
+  {
+    m_Data[index] = value;
+  }
+
+  /**
+   * @brief Returns the value at index.
+   * @param index
+   * @return const_reference
+   */
+  const_reference operator[](size_t index) const override
+  {
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Returns the value at index.
+   * @param index
+   * @return reference
+   */
+  reference operator[](size_t index) override
+  {
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Returns the value at index. Throws std::runtime_error if index is out of range.
+   * @param index
+   * @return const_reference
+   */
+  const_reference at(size_t index) const override
+  {
+    checkIndex(index);
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Returns the value at index. Throws std::runtime_error if index is out of range.
+   * @param index
+   * @return reference
+   */
+  reference at(size_t index) override
+  {
+    checkIndex(index);
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Copies the mapped values into a new in-memory complex::DataStore<T>.
+   * @return std::unique_ptr<complex::IDataStore>
+   */
+  std::unique_ptr<complex::IDataStore> deepCopy() const override
+  {
+    auto copy = std::make_unique<complex::DataStore<T>>(m_TupleShape, m_ComponentShape);
+    std::copy_n(m_Data, getSize(), copy->data());
+    return copy;
+  }
+
+  /**
+   * @brief Creates an in-memory complex::DataStore<T> with the same shape.
+   * @return std::unique_ptr<complex::IDataStore>
+   */
+  std::unique_ptr<complex::IDataStore> createNewInstance() const override
+  {
+    return std::make_unique<complex::DataStore<T>>(m_TupleShape, m_ComponentShape);
+  }
+
+  /**
+   * @brief Writes the values to HDF5 like a complex::DataStore<T>.
+   * @param datasetWriter
+   * @return complex::H5::ErrorType
+   */
+  complex::H5::ErrorType writeHdf5(complex::H5::DatasetWriter& datasetWriter) const override
+  {
+    std::vector<hsize_t> dims;
+    std::copy(m_TupleShape.cbegin(), m_TupleShape.cend(), std::back_inserter(dims));
+    std::copy(m_ComponentShape.cbegin(), m_ComponentShape.cend(), std::back_inserter(dims));
+    return datasetWriter.writeSpan(dims, nonstd::span<const T>(m_Data, getSize()));
+  }
+
+  /**
+   * @brief Returns the start of the mapped values.
+   * @return T*
+   */
+  T* data()
+  {
+    return m_Data;
+  }
+
+  /**
+   * @brief Returns the start of the mapped values.
+   * @return const T*
+   */
+  const T* data() const
+  {
+    return m_Data;
+  }
+
+  /**
+   * @brief Returns the mapped file.
+   * @return const std::shared_ptr<MappedFile>&
+   */
+  const std::shared_ptr<MappedFile>& getMappedFile() const
+  {
+    return m_File;
+  }
+
+private:
+  std::shared_ptr<MappedFile> m_File;
+  ShapeType m_TupleShape;
+  ShapeType m_ComponentShape;
+  T* m_Data = nullptr;
+
+  /**
+   * @brief Returns the total number of values.
+   * @return size_t
+   */
+  size_t getSize() const
+  {
+    return getNumberOfTuples() * getNumberOfComponents();
+  }
+
+  /**
+   * @brief Throws std::runtime_error if index is out of range.
+   * @param index
+   */
+  void checkIndex(size_t index) const
+  {
+    if(index >= getSize())
+    {
+      throw std::runtime_error("CV::MappedDataStore::at() index is out of range");
+    }
+  }
+};
+
+/**
+ * @brief Returns true if the data store keeps all values in one contiguous buffer that
+ * can be accessed through GetContiguousData(). This is the case for complex::DataStore<T>,
+ * CV::MappedDataStore<T> and CV::PooledDataStore<T>.
+ * @tparam T
+ * @param dataStore
+ * @return bool
+ */
+template <class T>
+bool IsContiguousStore(complex::AbstractDataStore<T>* dataStore)
+{
+  return dynamic_cast<complex::DataStore<T>*>(dataStore) != nullptr || dynamic_cast<MappedDataStore<T>*>(dataStore) != nullptr ||
+         dynamic_cast<PooledDataStore<T>*>(dataStore) != nullptr;
+}
+
+/**
+ * @brief Returns the contiguous value buffer of the data store or nullptr if the store
+ * is not contiguous or does not have a buffer yet.
+ * @tparam T
+ * @param dataStore
+ * @return T*
+ */
+template <class T>
+T* GetContiguousData(complex::AbstractDataStore<T>* dataStore)
+{
+  if(auto* contiguousStore = dynamic_cast<complex::DataStore<T>*>(dataStore))
+  {
+    return contiguousStore->data();
+  }
+  if(auto* mappedStore = dynamic_cast<MappedDataStore<T>*>(dataStore))
+  {
+    return mappedStore->data();
+  }
+  if(auto* pooledStore = dynamic_cast<PooledDataStore<T>*>(dataStore))
+  {
+    return pooledStore->data();
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Creates a complex DataArray in the DataStructure whose values are memory mapped
+ * from the raw binary file at filePath. This is the lazily loaded counterpart of
+ * complex::ImportFromBinaryFile and throws std::runtime_error if the file cannot be mapped.
+ * Unless writable is true, changes to the values are never written to the file.
+ * @tparam T
+ * @param filePath
+ * @param name
+ * @param dataStructure
+ * @param tupleShape
+ * @param componentShape
+ * @param parentId
+ * @param writable
+ * @return complex::DataArray<T>*
+ */
+template <class T>
+complex::DataArray<T>* CreateMappedDataArray(const std::filesystem::path& filePath, const std::string& name, complex::DataStructure& dataStructure, const std::vector<size_t>& tupleShape,
+                                             const std::vector<size_t>& componentShape, const std::optional<complex::DataObject::IdType>& parentId = {}, bool writable = false)
+{
+  auto dataStore = std::make_shared<MappedDataStore<T>>(filePath, tupleShape, componentShape, writable);
+  return complex::DataArray<T>::Create(dataStructure, name, dataStore, parentId);
+}
+} // namespace CV
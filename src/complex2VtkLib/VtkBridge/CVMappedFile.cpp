@@ -0,0 +1,136 @@
+#include "CVMappedFile.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace CV;
+
+std::shared_ptr<MappedFile> MappedFile::Open(const std::filesystem::path& filePath, bool writable)
+{
+  std::shared_ptr<MappedFile> mappedFile(new MappedFile());
+  mappedFile->m_Path = filePath;
+  mappedFile->m_Writable = writable;
+
+#ifdef _WIN32
+  const DWORD access = writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+  HANDLE file = CreateFileW(filePath.c_str(), access, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if(file == INVALID_HANDLE_VALUE)
+  {
+    throw std::runtime_error("CV::MappedFile::Open() could not open " + filePath.string());
+  }
+  LARGE_INTEGER fileSize;
+  if(!GetFileSizeEx(file, &fileSize))
+  {
+    CloseHandle(file);
+    throw std::runtime_error("CV::MappedFile::Open() could not read the size of " + filePath.string());
+  }
+  mappedFile->m_Size = static_cast<size_t>(fileSize.QuadPart);
+  if(mappedFile->m_Size > 0)
+  {
+    // PAGE_WRITECOPY + FILE_MAP_COPY gives a private copy-on-write view of a read-only file,
+    // PAGE_READWRITE + FILE_MAP_WRITE a shared view whose writes reach the file
+    HANDLE mapping = CreateFileMappingW(file, nullptr, writable ? PAGE_READWRITE : PAGE_WRITECOPY, 0, 0, nullptr);
+    if(mapping != nullptr)
+    {
+      mappedFile->m_Data = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_COPY, 0, 0, 0);
+      CloseHandle(mapping);
+    }
+    if(mappedFile->m_Data == nullptr)
+    {
+      CloseHandle(file);
+      throw std::runtime_error("CV::MappedFile::Open() could not map " + filePath.string());
+    }
+  }
+  CloseHandle(file);
+#else
+  int file = ::open(filePath.c_str(), writable ? O_RDWR : O_RDONLY);
+  if(file < 0)
+  {
+    throw std::runtime_error("CV::MappedFile::Open() could not open " + filePath.string());
+  }
+  struct stat fileStat;
+  if(::fstat(file, &fileStat) != 0)
+  {
+    ::close(file);
+    throw std::runtime_error("CV::MappedFile::Open() could not read the size of " + filePath.string());
+  }
+  mappedFile->m_Size = static_cast<size_t>(fileStat.st_size);
+  if(mappedFile->m_Size > 0)
+  {
+    // MAP_PRIVATE gives a copy-on-write mapping whose writes never reach the file,
+    // MAP_SHARED one whose writes do
+    void* data = ::mmap(nullptr, mappedFile->m_Size, PROT_READ | PROT_WRITE, writable ? MAP_SHARED : MAP_PRIVATE, file, 0);
+    if(data == MAP_FAILED)
+    {
+      ::close(file);
+      throw std::runtime_error("CV::MappedFile::Open() could not map " + filePath.string());
+    }
+    mappedFile->m_Data = data;
+  }
+  // The mapping keeps its own reference to the file
+  ::close(file);
+#endif
+
+  return mappedFile;
+}
+
+MappedFile::~MappedFile()
+{
+  if(m_Data == nullptr)
+  {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(m_Data);
+#else
+  ::munmap(m_Data, m_Size);
+#endif
+}
+
+void* MappedFile::data() const
+{
+  return m_Data;
+}
+
+size_t MappedFile::size() const
+{
+  return m_Size;
+}
+
+bool MappedFile::isWritable() const
+{
+  return m_Writable;
+}
+
+void MappedFile::flush() const
+{
+  if(!m_Writable || m_Data == nullptr)
+  {
+    return;
+  }
+#ifdef _WIN32
+  if(!FlushViewOfFile(m_Data, 0))
+#else
+  if(::msync(m_Data, m_Size, MS_SYNC) != 0)
+#endif
+  {
+    throw std::runtime_error("CV::MappedFile::flush() could not write back " + m_Path.string());
+  }
+}
+
+const std::filesystem::path& MappedFile::path() const
+{
+  return m_Path;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::MappedFile
+ * @brief The MappedFile class maps an entire file into memory. Pages are loaded
+ * lazily by the OS when they are first touched.
+ *
+ * Read-only files are mapped copy-on-write: the file is never modified, and writes to
+ * the mapping go to private copies of the touched pages that are discarded when the
+ * file is unmapped. Writable files are mapped shared: writes reach the file when the
+ * OS writes the dirty pages back, at the latest on flush() or when the file is unmapped.
+ */
+class COMPLEX2VTKLIB_EXPORT MappedFile
+{
+public:
+  /**
+   * @brief Maps the file at filePath. Throws std::runtime_error if the file cannot
+   * be opened or mapped.
+   * @param filePath
+   * @param writable If true, the file is opened for writing and mapped shared.
+   * Otherwise it is opened read-only and mapped copy-on-write.
+   * @return std::shared_ptr<MappedFile>
+   */
+  static std::shared_ptr<MappedFile> Open(const std::filesystem::path& filePath, bool writable = false);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) noexcept = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&&) noexcept = delete;
+
+  /**
+   * @brief Unmaps the file.
+   */
+  ~MappedFile();
+
+  /**
+   * @brief Returns the start of the mapping or nullptr for empty files.
+   * @return void*
+   */
+  void* data() const;
+
+  /**
+   * @brief Returns the size of the mapped file in bytes.
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns true if writes to the mapping reach the file.
+   * @return bool
+   */
+  bool isWritable() const;
+
+  /**
+   * @brief Writes the modified pages of a writable mapping back to the file. On POSIX
+   * systems this waits for the write to finish (msync with MS_SYNC), on Windows the
+   * pages are handed to the OS (FlushViewOfFile). Does nothing for copy-on-write
+   * mappings. Throws std::runtime_error if the pages cannot be written.
+   */
+  void flush() const;
+
+  /**
+   * @brief Returns the path of the mapped file.
+   * @return const std::filesystem::path&
+   */
+  const std::filesystem::path& path() const;
+
+protected:
+  /**
+   * @brief Default constructor
+   */
+  MappedFile() = default;
+
+private:
+  std::filesystem::path m_Path;
+  void* m_Data = nullptr;
+  size_t m_Size = 0;
+  bool m_Writable = false;
+};
+} // namespace CV
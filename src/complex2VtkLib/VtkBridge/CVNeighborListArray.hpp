@@ -0,0 +1,368 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+#include "vtkAOSDataArrayTemplate.h"
+#include "vtkCellArray.h"
+#include "vtkDataArray.h"
+#include "vtkGenericDataArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkSMPTools.h"
+#include "vtkSetGet.h"
+#include "vtkSmartPointer.h"
+
+#include "complex/DataStructure/NeighborList.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVFixedSizeArray.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::NeighborListArray
+ * @brief The NeighborListArray class presents the ragged lists of a complex
+ * NeighborList<T> as a flat single-component vtkDataArray. Together with the
+ * offsets array returned by GetOffsetsArray() it forms the offsets + values pair
+ * used by vtkCellArray: the values of list i are the values [offsets[i], offsets[i + 1]).
+ *
+ * The values are read from the lists themselves, without flattening them into a
+ * new buffer. Only the offsets are built, in parallel, when the NeighborList is set.
+ * Each thread keeps a cursor on the list it read last, so sequential sweeps find the
+ * list of a value in O(1); other reads binary search the offsets. SetValue() writes
+ * through to the lists. Call UpdateOffsets() after lists were added, removed or
+ * resized on the complex side. CreateCellArray() is the only place that flattens the
+ * values, on demand.
+ * @tparam T
+ */
+template <class T>
+class NeighborListArray : public CV::FixedSizeArray<CV::NeighborListArray<T>, T>
+{
+public:
+  using SelfType = CV::NeighborListArray<T>;
+  using NeighborListType = complex::NeighborList<T>;
+  using NeighborListPointerType = std::shared_ptr<NeighborListType>;
+  using ValueType = T;
+  using Superclass2 = CV::FixedSizeArray<SelfType, T>;
+
+  vtkAbstractTypeMacroWithNewInstanceType(SelfType, Superclass2, vtkDataArray, typeid(SelfType).name());
+
+  /**
+   * @brief Creates a new instance of CV::NeighborListArray. This is required of vtkObject derived classes
+   * @return
+   */
+  static SelfType* New()
+  {
+    return new SelfType();
+  }
+
+  /**
+   * @brief
+   */
+  NeighborListArray()
+  : Superclass()
+  {
+  }
+
+  /**
+   * @brief
+   * @param neighborList
+   */
+  NeighborListArray(const NeighborListPointerType& neighborList)
+  : Superclass()
+  {
+    SetNeighborList(neighborList);
+  }
+
+  NeighborListArray(const NeighborListArray&) = delete;
+  NeighborListArray(NeighborListArray&&) noexcept = delete;
+  NeighborListArray& operator=(const NeighborListArray&) = delete;
+  NeighborListArray& operator=(NeighborListArray&&) noexcept = delete;
+
+  virtual ~NeighborListArray() = default;
+
+  /**
+   * @brief Sets the wrapped NeighborList and builds its offsets.
+   * @param neighborList
+   */
+  void SetNeighborList(const NeighborListPointerType& neighborList)
+  {
+    m_NeighborList = neighborList;
+    if(neighborList != nullptr)
+    {
+      this->SetName(neighborList->getName().c_str());
+    }
+    UpdateOffsets();
+  }
+
+  /**
+   * @brief Rebuilds the cached list pointers and offsets from the current lists. This
+   * must be called after lists were added, removed or resized on the complex side.
+   */
+  void UpdateOffsets()
+  {
+    m_Lists.clear();
+    if(m_Offsets == nullptr)
+    {
+      m_Offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+    }
+    const std::string name = (this->GetName() == nullptr ? std::string() : std::string(this->GetName())) + "_Offsets";
+    m_Offsets->SetName(name.c_str());
+
+    const vtkIdType numLists = m_NeighborList == nullptr ? 0 : static_cast<vtkIdType>(m_NeighborList->getNumberOfLists());
+    m_Lists.resize(numLists, nullptr);
+    m_Offsets->SetNumberOfValues(numLists + 1);
+    vtkIdType* offsets = m_Offsets->GetPointer(0);
+    offsets[0] = 0;
+
+    // Gather the list pointers and their sizes in parallel, then turn the sizes
+    // into offsets with a parallel block-wise prefix sum.
+    vtkSMPTools::For(0, numLists, [this, offsets](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType listIdx = begin; listIdx < end; listIdx++)
+      {
+        auto list = m_NeighborList->getList(static_cast<int32_t>(listIdx));
+        m_Lists[listIdx] = list.get();
+        offsets[listIdx + 1] = list == nullptr ? 0 : static_cast<vtkIdType>(list->size());
+      }
+    });
+    InclusiveScan(offsets + 1, numLists);
+    m_Offsets->Modified();
+    m_RawOffsets = offsets;
+
+    this->NumberOfComponents = 1;
+    this->Size = offsets[numLists];
+    this->MaxId = this->Size - 1;
+    this->Modified();
+  }
+
+  /**
+   * @brief Returns the cached offsets array with GetNumberOfLists() + 1 values.
+   * @return vtkIdTypeArray*
+   */
+  vtkIdTypeArray* GetOffsetsArray() const
+  {
+    return m_Offsets;
+  }
+
+  /**
+   * @brief Creates a vtkCellArray with one cell per list. vtkCellArray needs a
+   * contiguous connectivity array with the same value type as its offsets, so the
+   * values are copied into a new array in parallel and the offsets are converted to
+   * the value type. The cell array does not see later changes to the lists. Only
+   * available for 32 and 64 bit signed integer lists.
+   * @return vtkSmartPointer<vtkCellArray>
+   */
+  vtkSmartPointer<vtkCellArray> CreateCellArray() const
+  {
+    static_assert(std::is_integral<T>::value && std::is_signed<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), "CV::NeighborListArray::CreateCellArray() requires 32 or 64 bit signed integer lists");
+    const vtkIdType numOffsets = m_Offsets->GetNumberOfValues();
+    auto offsets = vtkSmartPointer<vtkAOSDataArrayTemplate<T>>::New();
+    offsets->SetNumberOfValues(numOffsets);
+    const vtkIdType* offsetsIn = m_Offsets->GetPointer(0);
+    ValueType* offsetsOut = offsets->GetPointer(0);
+    vtkSMPTools::For(0, numOffsets, [offsetsIn, offsetsOut](vtkIdType begin, vtkIdType end) { std::transform(offsetsIn + begin, offsetsIn + end, offsetsOut + begin, [](vtkIdType offset) { return static_cast<ValueType>(offset); }); });
+
+    auto connectivity = vtkSmartPointer<vtkAOSDataArrayTemplate<T>>::New();
+    connectivity->SetName(this->GetName());
+    connectivity->SetNumberOfValues(this->Size);
+    ValueType* values = connectivity->GetPointer(0);
+    const vtkIdType numLists = GetNumberOfLists();
+    vtkSMPTools::For(0, numLists, [this, offsetsIn, values](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType listIdx = begin; listIdx < end; listIdx++)
+      {
+        if(m_Lists[listIdx] != nullptr)
+        {
+          std::copy(m_Lists[listIdx]->begin(), m_Lists[listIdx]->end(), values + offsetsIn[listIdx]);
+        }
+      }
+    });
+
+    auto cellArray = vtkSmartPointer<vtkCellArray>::New();
+    cellArray->SetData(offsets, connectivity);
+    return cellArray;
+  }
+
+  /**
+   * @brief Returns the number of lists in the wrapped NeighborList.
+   * @return vtkIdType
+   */
+  vtkIdType GetNumberOfLists() const
+  {
+    return static_cast<vtkIdType>(m_Lists.size());
+  }
+
+  /**
+   * @brief Get the value at valueIdx.
+   * @param valueIdx
+   * @return T
+   */
+  inline ValueType GetValue(vtkIdType valueIdx) const
+  {
+    const vtkIdType listIdx = findList(valueIdx);
+    return (*m_Lists[listIdx])[valueIdx - m_RawOffsets[listIdx]];
+  }
+
+  /**
+   * @brief Set the value at valueIdx to value. This writes through to the NeighborList.
+   * @param valueIdx
+   * @param value
+   */
+  inline void SetValue(vtkIdType valueIdx, ValueType value)
+  {
+    const vtkIdType listIdx = findList(valueIdx);
+    (*m_Lists[listIdx])[valueIdx - m_RawOffsets[listIdx]] = value;
+  }
+
+  /**
+   * @brief Copy the tuple at tupleIdx into tuple.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
+  {
+    tuple[0] = GetValue(tupleIdx);
+  }
+
+  /**
+   * @brief Set this array's tuple at tupleIdx to the values in tuple.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
+  {
+    SetValue(tupleIdx, tuple[0]);
+  }
+
+  /**
+   * @brief Get component compIdx of the tuple at tupleIdx. The array only has a single component.
+   * @param tupleIdx
+   * @param compIdx
+   * @return T
+   */
+  inline ValueType GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
+  {
+    return GetValue(tupleIdx);
+  }
+
+  /**
+   * @brief Set component compIdx of the tuple at tupleIdx to value. The array only has a single component.
+   * @param tupleIdx
+   * @param compIdx
+   * @param value
+   */
+  inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, ValueType value)
+  {
+    SetValue(tupleIdx, value);
+  }
+
+  /**
+   * @brief Replaces values[0, count) with its inclusive prefix sum. Blocks are summed
+   * in parallel, the block totals are scanned serially, and each block is then
+   * offset by the preceding total in parallel.
+   * @param values
+   * @param count
+   */
+  static void InclusiveScan(vtkIdType* values, vtkIdType count)
+  {
+    constexpr vtkIdType k_BlockSize = 1 << 16;
+    const vtkIdType numBlocks = (count + k_BlockSize - 1) / k_BlockSize;
+    std::vector<vtkIdType> blockTotals(numBlocks + 1, 0);
+    vtkSMPTools::For(0, numBlocks, [values, count, &blockTotals](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType block = begin; block < end; block++)
+      {
+        vtkIdType* blockStart = values + block * k_BlockSize;
+        vtkIdType* blockEnd = values + std::min(count, (block + 1) * k_BlockSize);
+        std::partial_sum(blockStart, blockEnd, blockStart);
+        blockTotals[block + 1] = *(blockEnd - 1);
+      }
+    });
+    std::partial_sum(blockTotals.begin(), blockTotals.end(), blockTotals.begin());
+    vtkSMPTools::For(1, numBlocks, [values, count, &blockTotals](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType block = begin; block < end; block++)
+      {
+        vtkIdType* blockStart = values + block * k_BlockSize;
+        vtkIdType* blockEnd = values + std::min(count, (block + 1) * k_BlockSize);
+        const vtkIdType blockOffset = blockTotals[block];
+        std::for_each(blockStart, blockEnd, [blockOffset](vtkIdType& value) { value += blockOffset; });
+      }
+    });
+  }
+
+private:
+  friend class CV::FixedSizeArray<SelfType, T>;
+
+  NeighborListPointerType m_NeighborList;
+  std::vector<std::vector<T>*> m_Lists;
+  vtkSmartPointer<vtkIdTypeArray> m_Offsets;
+  const vtkIdType* m_RawOffsets = nullptr;
+
+  /**
+   * @brief Number of lists a cursor steps forward before falling back to a binary search.
+   */
+  static constexpr vtkIdType k_MaxCursorSteps = 8;
+
+  /**
+   * @brief The list a thread read last, per array.
+   */
+  struct ListCursor
+  {
+    const SelfType* array = nullptr;
+    vtkIdType listIdx = 0;
+  };
+
+  /**
+   * @brief Returns the index of the list containing the flat value index. The calling
+   * thread's cursor is tried first and stepped forward over a few lists, which covers
+   * sequential sweeps including runs of empty lists. Otherwise the offsets are binary
+   * searched. The cursor is only a hint and is checked against the offsets, so it
+   * cannot go stale.
+   * @param valueIdx
+   * @return vtkIdType
+   */
+  vtkIdType findList(vtkIdType valueIdx) const
+  {
+    if(m_Lists.empty())
+    {
+      throw std::runtime_error("CV::NeighborListArray does not have an underlying complex::NeighborList");
+    }
+    static thread_local ListCursor cursor;
+    const vtkIdType numLists = GetNumberOfLists();
+    const vtkIdType* offsets = m_RawOffsets;
+    if(cursor.array == this && cursor.listIdx < numLists && offsets[cursor.listIdx] <= valueIdx)
+    {
+      vtkIdType listIdx = cursor.listIdx;
+      for(vtkIdType step = 0; step < k_MaxCursorSteps && listIdx < numLists; step++, listIdx++)
+      {
+        if(valueIdx < offsets[listIdx + 1])
+        {
+          cursor.listIdx = listIdx;
+          return listIdx;
+        }
+      }
+    }
+
+    // The last offset not greater than valueIdx marks the list. Empty lists share
+    // their offset with the following list, which upper_bound skips.
+    const vtkIdType* listEnd = std::upper_bound(offsets, offsets + numLists + 1, valueIdx);
+    cursor.array = this;
+    cursor.listIdx = static_cast<vtkIdType>(listEnd - offsets) - 1;
+    return cursor.listIdx;
+  }
+
+  /**
+   * @brief Returns the total number of values in the wrapped lists.
+   * Used by CV::FixedSizeArray to reject resizing.
+   * @return vtkIdType
+   */
+  vtkIdType getFixedNumberOfTuples() const
+  {
+    return this->Size;
+  }
+};
+} // namespace CV
@@ -0,0 +1,450 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+#include <vtkCellType.h>
+#include <vtkCellTypes.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
+#include <vtkMappedUnstructuredGrid.h>
+
+#include "complex/DataStructure/DataArray.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVMappedCellIterator.hpp"
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+#include "complex2VtkLib/VtkBridge/CVPointCellLinks.hpp"
+#include "complex2VtkLib/VtkBridge/VtkBridge.hpp"
+#include "complex2VtkLib/VtkBridge/VtkMacros.hpp"
+
+namespace CV
+{
+template <class Traits>
+class NodeGrid;
+
+/**
+ * @class CV::NodeGeomImpl
+ * @brief The NodeGeomImpl class is the vtkMappedUnstructuredGrid implementation for
+ * complex node geometries whose cells all have the same type and number of points.
+ * It maps the cell and point IDs from the complex geometry. CreateFromGeom() also sets
+ * the grid's points to a CV::Array<float, 3> over the geometry's shared vertex list,
+ * so the wrapped grid is complete without copying any coordinates.
+ *
+ * Everything specific to a geometry comes from Traits:
+ * - GeomType: the complex geometry class
+ * - k_CellType: the VTK cell type
+ * - k_NumVerts: the number of points per cell
+ * - GetNumberOfCells(GeomType&): the number of cells
+ * - GetConnectivity(GeomType&): the complex connectivity list, or nullptr if there is none
+ * - GetCellVerts(GeomType&, size_t cellId, size_t* verts): the point ids of a cell
+ *
+ * If the connectivity list is held in a contiguous store, cell points are read from it
+ * directly in loops of k_NumVerts iterations. Otherwise they come from GetCellVerts().
+ * The raw connectivity pointer is looked up by SetGeometry(), Modified() and
+ * GetConnectivityPointer(), which CV::MappedCellIterator calls whenever a traversal
+ * starts. GetCellPoints() uses the pointer from the last lookup, so call Modified()
+ * after replacing or resizing the complex connectivity list.
+ * @tparam Traits
+ */
+template <class Traits>
+class NodeGeomImpl : public vtkObject
+{
+public:
+  using GeomType = typename Traits::GeomType;
+  using ThisType = NodeGeomImpl<Traits>;
+  using GridType = NodeGrid<Traits>;
+
+  static constexpr int k_CellType = Traits::k_CellType;
+  static constexpr int k_NumVerts = Traits::k_NumVerts;
+
+  vtkTemplateTypeMacro(ThisType, vtkObject);
+
+  /**
+   * @brief Creates a GridType wrapping the complex geometry. Returns nullptr if the
+   * geometry is null.
+   * @param geom
+   * @return VTK_PTR(vtkDataSet)
+   */
+  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<GeomType>& geom);
+
+  static NodeGeomImpl* New()
+  {
+    return new NodeGeomImpl();
+  }
+
+  void PrintSelf(ostream& os, vtkIndent indent) override
+  {
+    this->Superclass::PrintSelf(os, indent);
+    os << indent << "CellType: " << vtkCellTypes::GetClassNameFromTypeId(k_CellType) << endl;
+    os << indent << "CellSize: " << k_NumVerts << endl;
+    os << indent << "NumberOfCells: " << GetNumberOfCells() << endl;
+    os << indent << "RawConnectivity: " << (m_RawConnectivity.load(std::memory_order_relaxed) != nullptr) << endl;
+  }
+
+  /**
+   * @brief Sets the complex geometry.
+   * @param geom
+   */
+  void SetGeometry(const std::shared_ptr<GeomType>& geom)
+  {
+    m_Geom = geom;
+    updateConnectivity();
+    m_PointCellLinks.clear();
+  }
+
+  /**
+   * @brief Returns the number of cells in the geometry.
+   * @return vtkIdType
+   */
+  vtkIdType GetNumberOfCells()
+  {
+    if(nullptr == m_Geom)
+    {
+      vtkErrorMacro("Wrapper Geometry missing a Geometry object");
+      return -1;
+    }
+
+    return static_cast<vtkIdType>(Traits::GetNumberOfCells(*m_Geom));
+  }
+
+  /**
+   * @brief Returns the cell type for the given cell ID.
+   * @param cellId
+   * @return int
+   */
+  int GetCellType(vtkIdType cellId)
+  {
+    if(0 == GetNumberOfCells())
+    {
+      return VTK_EMPTY_CELL;
+    }
+
+    return k_CellType;
+  }
+
+  /**
+   * @brief Gets a list of point IDs used by the cell ID. Reads the raw connectivity
+   * pointer from the last lookup, see the class documentation.
+   * @param cellId
+   * @param ptIds
+   */
+  void GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
+  {
+    ptIds->SetNumberOfIds(k_NumVerts);
+    vtkIdType* ids = ptIds->GetPointer(0);
+    if(const uint64_t* rawConnectivity = m_RawConnectivity.load(std::memory_order_acquire))
+    {
+      const uint64_t* cellPoints = rawConnectivity + cellId * k_NumVerts;
+      for(int i = 0; i < k_NumVerts; i++)
+      {
+        ids[i] = static_cast<vtkIdType>(cellPoints[i]);
+      }
+      return;
+    }
+
+    size_t verts[k_NumVerts];
+    Traits::GetCellVerts(*m_Geom, static_cast<size_t>(cellId), verts);
+    for(int i = 0; i < k_NumVerts; i++)
+    {
+      ids[i] = static_cast<vtkIdType>(verts[i]);
+    }
+  }
+
+  /**
+   * @brief Gets a list of cell IDs that use the given point ID. The point to cell
+   * links are built in parallel on the first call and cached until the connectivity
+   * store is replaced or resized, the geometry is replaced or the implementation is
+   * modified. Geometries without a connectivity list
+   * have one vertex cell per point and need no links.
+   * @param ptId
+   * @param cellIds
+   */
+  void GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
+  {
+    if(nullptr == m_Geom)
+    {
+      vtkErrorMacro("Wrapper Geometry missing a Geometry object");
+      cellIds->Reset();
+      return;
+    }
+    if constexpr(k_NumVerts == 1)
+    {
+      if(nullptr == m_Connectivity)
+      {
+        cellIds->SetNumberOfIds(1);
+        cellIds->SetId(0, ptId);
+        return;
+      }
+    }
+
+    // The links are keyed on the connectivity store, so the fast path only looks at the
+    // store and its size. The sizes and the raw pointer are only needed for a rebuild.
+    const auto* connectivityStore = nullptr == m_Connectivity ? nullptr : m_Connectivity->getDataStore();
+    const size_t numConnectivityTuples = nullptr == m_Connectivity ? 0 : m_Connectivity->getNumberOfTuples();
+    const uint64_t* rawConnectivity = nullptr;
+    GeomType* geom = m_Geom.get();
+    m_PointCellLinks.ensureBuilt(
+        connectivityStore, numConnectivityTuples, k_NumVerts,
+        [this, &rawConnectivity]() {
+          rawConnectivity = currentRawConnectivity();
+          const auto* vertices = m_Geom->getVertices();
+          const size_t numPoints = nullptr == vertices ? 0 : vertices->getNumberOfTuples();
+          return std::make_pair(numPoints, static_cast<size_t>(Traits::GetNumberOfCells(*m_Geom)));
+        },
+        [&rawConnectivity, geom](size_t cellId, size_t* verts) {
+          if(nullptr != rawConnectivity)
+          {
+            std::copy_n(rawConnectivity + cellId * k_NumVerts, k_NumVerts, verts);
+            return;
+          }
+          Traits::GetCellVerts(*geom, cellId, verts);
+        });
+    m_PointCellLinks.getPointCells(ptId, cellIds);
+  }
+
+  /**
+   * @brief Looks up the raw connectivity pointer again and drops the cached point to
+   * cell links, e.g. after the complex connectivity list was changed.
+   */
+  void Modified() override
+  {
+    this->Superclass::Modified();
+    updateConnectivity();
+    m_PointCellLinks.clear();
+  }
+
+  /**
+   * @brief Returns the number of points per cell.
+   * @return int
+   */
+  int GetCellSize() const
+  {
+    return k_NumVerts;
+  }
+
+  /**
+   * @brief Returns the complex connectivity list as GetNumberOfCells() * k_NumVerts
+   * contiguous point ids, or nullptr if there is none or it is not held in a
+   * contiguous store. The pointer is looked up again if the store was replaced or
+   * resized since the last lookup, and stays valid until that happens next.
+   * @return const uint64_t*
+   */
+  const uint64_t* GetConnectivityPointer()
+  {
+    return currentRawConnectivity();
+  }
+
+  /**
+   * @brief Returns the maximum cell size.
+   * @return int
+   */
+  int GetMaxCellSize()
+  {
+    return k_NumVerts;
+  }
+
+  /**
+   * @brief Gets a list of all cell IDs of a given type.
+   * @param type
+   * @param array
+   */
+  void GetIdsOfCellsOfType(int type, vtkIdTypeArray* array)
+  {
+    array->Reset();
+    if(k_CellType != type || GetNumberOfCells() <= 0)
+    {
+      return;
+    }
+
+    const vtkIdType numCells = GetNumberOfCells();
+    array->SetNumberOfComponents(1);
+    array->SetNumberOfTuples(numCells);
+    vtkIdType* ids = array->GetPointer(0);
+    std::iota(ids, ids + numCells, vtkIdType(0));
+  }
+
+  /**
+   * @brief Returns whether or not all cells are of the same type.
+   * @return int
+   */
+  int IsHomogeneous()
+  {
+    return 1;
+  }
+
+  /**
+   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
+   * this read-only implementation.
+   * @param numCells
+   * @param extSize
+   */
+  void Allocate(vtkIdType numCells, int extSize = 1000)
+  {
+    vtkErrorMacro("Read only container.");
+  }
+
+  /**
+   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
+   * this read-only implementation.
+   * @param type
+   * @param ptIds
+   * @return vtkIdType
+   */
+  vtkIdType InsertNextCell(int type, const vtkIdList ptIds[])
+  {
+    vtkErrorMacro("Read only container.");
+    return -1;
+  }
+
+  /**
+   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
+   * this read-only implementation.
+   * @param type
+   * @param npts
+   * @param ptIds
+   * @return vtkIdType
+   */
+  vtkIdType InsertNextCell(int type, vtkIdType npts, const vtkIdType ptIds[])
+  {
+    vtkErrorMacro("Read only container.");
+    return -1;
+  }
+
+  /**
+   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
+   * this read-only implementation.
+   * @param type
+   * @param npts
+   * @param ptIds
+   * @param nfaces
+   * @param faces
+   * @return vtkIdType
+   */
+  vtkIdType InsertNextCell(int type, vtkIdType npts, const vtkIdType ptIds[], vtkIdType nfaces, const vtkIdType faces[])
+  {
+    // The geometry should probably not be modified by VTK calls
+    // To prevent spamming errors when loading this data, do not call vtkErrorMacro
+    return -1;
+  }
+
+  /**
+   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
+   * this read-only implementation.
+   * @param cellId
+   * @param npts
+   * @param pts
+   */
+  void ReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[])
+  {
+    vtkErrorMacro("Read only container.");
+  }
+
+protected:
+  /**
+   * @brief Default constructor
+   */
+  NodeGeomImpl() = default;
+  ~NodeGeomImpl() override = default;
+
+private:
+  std::shared_ptr<GeomType> m_Geom = nullptr;
+  std::shared_ptr<complex::UInt64Array> m_Connectivity = nullptr;
+  std::atomic<const void*> m_ConnectivityStore{nullptr};
+  std::atomic<size_t> m_NumConnectivityTuples{0};
+  std::atomic<const uint64_t*> m_RawConnectivity{nullptr};
+  CV::PointCellLinks m_PointCellLinks;
+
+  /**
+   * @brief Looks up the connectivity list and its raw pointer.
+   */
+  void updateConnectivity()
+  {
+    m_Connectivity = nullptr == m_Geom ? nullptr : Traits::GetConnectivity(*m_Geom);
+    m_ConnectivityStore.store(nullptr, std::memory_order_relaxed);
+    m_NumConnectivityTuples.store(0, std::memory_order_relaxed);
+    m_RawConnectivity.store(nullptr, std::memory_order_relaxed);
+    currentRawConnectivity();
+  }
+
+  /**
+   * @brief Returns the raw pointer of the connectivity list. complex can replace the
+   * list's store or resize it in place, which moves its buffer, so the cached pointer
+   * is only used while the store and its number of tuples are unchanged. Threads that
+   * look it up concurrently store the same values; the raw pointer is published before
+   * the key it belongs to.
+   * @return const uint64_t*
+   */
+  const uint64_t* currentRawConnectivity()
+  {
+    if(nullptr == m_Connectivity)
+    {
+      return nullptr;
+    }
+    auto* store = m_Connectivity->getDataStore();
+    const size_t numTuples = m_Connectivity->getNumberOfTuples();
+    if(m_ConnectivityStore.load(std::memory_order_acquire) == store && m_NumConnectivityTuples.load(std::memory_order_acquire) == numTuples)
+    {
+      return m_RawConnectivity.load(std::memory_order_relaxed);
+    }
+    const uint64_t* rawConnectivity = CV::GetContiguousData(store);
+    m_RawConnectivity.store(rawConnectivity, std::memory_order_release);
+    m_NumConnectivityTuples.store(numTuples, std::memory_order_release);
+    m_ConnectivityStore.store(store, std::memory_order_release);
+    return rawConnectivity;
+  }
+
+  NodeGeomImpl(const NodeGeomImpl&) = delete;
+  void operator=(const NodeGeomImpl&) = delete;
+};
+
+/**
+ * @class CV::NodeGrid
+ * @brief The NodeGrid class is the vtkMappedUnstructuredGrid over a NodeGeomImpl. It
+ * iterates cells with CV::MappedCellIterator.
+ * @tparam Traits
+ */
+template <class Traits>
+class NodeGrid : public vtkMappedUnstructuredGrid<NodeGeomImpl<Traits>, MappedCellIterator<NodeGeomImpl<Traits>>>
+{
+public:
+  using GridBase = vtkMappedUnstructuredGrid<NodeGeomImpl<Traits>, MappedCellIterator<NodeGeomImpl<Traits>>>;
+  using ThisType = NodeGrid<Traits>;
+
+  vtkTemplateTypeMacro(ThisType, GridBase);
+
+  static NodeGrid* New()
+  {
+    return new NodeGrid();
+  }
+
+protected:
+  NodeGrid()
+  {
+    VTK_NEW(NodeGeomImpl<Traits>, impl);
+    this->SetImplementation(impl);
+  }
+  ~NodeGrid() override = default;
+
+private:
+  NodeGrid(const NodeGrid&) = delete;
+  void operator=(const NodeGrid&) = delete;
+};
+
+template <class Traits>
+VTK_PTR(vtkDataSet) NodeGeomImpl<Traits>::CreateFromGeom(const std::shared_ptr<GeomType>& geom)
+{
+  if(geom == nullptr)
+  {
+    return nullptr;
+  }
+  VTK_NEW(GridType, dataSet);
+  dataSet->GetImplementation()->SetGeometry(geom);
+  dataSet->SetPoints(CV::VtkBridge::wrapVertexList(geom->getVertices()));
+
+  return dataSet;
+}
+} // namespace CV
@@ -0,0 +1,83 @@
+#include "CVPointCellLinks.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+using namespace CV;
+
+bool PointCellLinks::isBuilt() const
+{
+  return m_Built.load(std::memory_order_acquire);
+}
+
+void PointCellLinks::clear()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Links = std::monostate();
+  m_Built.store(false, std::memory_order_release);
+}
+
+void PointCellLinks::getPointCells(vtkIdType ptId, vtkIdList* cellIds) const
+{
+  std::visit(
+      [ptId, cellIds](const auto& links) {
+        using LinksType = std::decay_t<decltype(links)>;
+        if constexpr(std::is_same_v<LinksType, std::monostate>)
+        {
+          cellIds->Reset();
+        }
+        else
+        {
+          if(ptId < 0 || static_cast<size_t>(ptId) + 1 >= links.offsets.size())
+          {
+            cellIds->Reset();
+            return;
+          }
+          const auto begin = links.offsets[ptId];
+          const auto end = links.offsets[ptId + 1];
+          cellIds->SetNumberOfIds(static_cast<vtkIdType>(end - begin));
+          vtkIdType* ids = cellIds->GetPointer(0);
+          std::copy(links.cellIds.cbegin() + begin, links.cellIds.cbegin() + end, ids);
+        }
+      },
+      m_Links);
+}
+
+size_t PointCellLinks::getNumberOfCells(vtkIdType ptId) const
+{
+  return std::visit(
+      [ptId](const auto& links) -> size_t {
+        using LinksType = std::decay_t<decltype(links)>;
+        if constexpr(std::is_same_v<LinksType, std::monostate>)
+        {
+          return 0;
+        }
+        else
+        {
+          if(ptId < 0 || static_cast<size_t>(ptId) + 1 >= links.offsets.size())
+          {
+            return 0;
+          }
+          return links.offsets[ptId + 1] - links.offsets[ptId];
+        }
+      },
+      m_Links);
+}
+
+size_t PointCellLinks::getMemorySize() const
+{
+  return std::visit(
+      [](const auto& links) -> size_t {
+        using LinksType = std::decay_t<decltype(links)>;
+        if constexpr(std::is_same_v<LinksType, std::monostate>)
+        {
+          return 0;
+        }
+        else
+        {
+          using IndexType = typename decltype(links.offsets)::value_type;
+          return (links.offsets.size() + links.cellIds.size()) * sizeof(IndexType);
+        }
+      },
+      m_Links);
+}
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <variant>
+#include <vector>
+
+#include <vtkIdList.h>
+#include <vtkSMPTools.h>
+#include <vtkType.h>
+
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::PointCellLinks
+ * @brief The PointCellLinks class holds the cells that use each point of a mesh with
+ * a fixed number of points per cell in compressed sparse row form: the cells of point
+ * p are cellIds[offsets[p], offsets[p + 1]), in ascending order. 32-bit indices are
+ * used whenever the number of cell points fits, halving the memory of the links of
+ * large surface and tetrahedral meshes.
+ *
+ * The links are built lazily by ensureBuilt() in three parallel passes: counting the
+ * cells of every point, a block-wise prefix sum to get the offsets and scattering the
+ * cell ids. They are keyed on the connectivity they were built from, its store and
+ * number of tuples, so ensureBuilt() rebuilds them when the connectivity store is
+ * replaced or resized. The mapped grid implementations also drop them when their
+ * geometry changes or they are modified.
+ */
+class COMPLEX2VTKLIB_EXPORT PointCellLinks
+{
+public:
+  PointCellLinks() = default;
+  ~PointCellLinks() = default;
+
+  PointCellLinks(const PointCellLinks&) = delete;
+  PointCellLinks(PointCellLinks&&) noexcept = delete;
+  PointCellLinks& operator=(const PointCellLinks&) = delete;
+  PointCellLinks& operator=(PointCellLinks&&) noexcept = delete;
+
+  /**
+   * @brief Builds the links unless they are built already for the connectivity store
+   * connectivityStore with numTuples tuples. Only then is getSizes() called; it must
+   * return the number of points and the number of cells. getCellPoints(cellId, size_t*)
+   * must write the cellSize point ids of cell cellId and may be called concurrently.
+   * Point ids outside [0, numPoints) are ignored. Safe to call from several threads, but
+   * not concurrently with getPointCells() if the connectivity changed.
+   * @tparam GetSizesT
+   * @tparam GetCellPointsT
+   * @param connectivityStore
+   * @param numTuples
+   * @param cellSize
+   * @param getSizes
+   * @param getCellPoints
+   */
+  template <class GetSizesT, class GetCellPointsT>
+  void ensureBuilt(const void* connectivityStore, size_t numTuples, int cellSize, GetSizesT&& getSizes, GetCellPointsT&& getCellPoints)
+  {
+    if(isBuiltFor(connectivityStore, numTuples))
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if(isBuiltFor(connectivityStore, numTuples))
+    {
+      return;
+    }
+    m_Built.store(false, std::memory_order_relaxed);
+    const auto [numPoints, numCells] = getSizes();
+    if(numCells * static_cast<size_t>(cellSize) < std::numeric_limits<uint32_t>::max())
+    {
+      m_Links = build<uint32_t>(numPoints, numCells, cellSize, getCellPoints);
+    }
+    else
+    {
+      m_Links = build<uint64_t>(numPoints, numCells, cellSize, getCellPoints);
+    }
+    m_ConnectivityStore.store(connectivityStore, std::memory_order_relaxed);
+    m_NumTuples.store(numTuples, std::memory_order_relaxed);
+    m_Built.store(true, std::memory_order_release);
+  }
+
+  /**
+   * @brief Returns true if the links are built.
+   * @return bool
+   */
+  bool isBuilt() const;
+
+  /**
+   * @brief Drops the links so that the next ensureBuilt() call rebuilds them. Must not be
+   * called concurrently with getPointCells().
+   */
+  void clear();
+
+  /**
+   * @brief Sets cellIds to the cells that use the point. The links must be built.
+   * @param ptId
+   * @param cellIds
+   */
+  void getPointCells(vtkIdType ptId, vtkIdList* cellIds) const;
+
+  /**
+   * @brief Returns the number of cells that use the point. The links must be built.
+   * @param ptId
+   * @return size_t
+   */
+  size_t getNumberOfCells(vtkIdType ptId) const;
+
+  /**
+   * @brief Returns the number of bytes held by the links.
+   * @return size_t
+   */
+  size_t getMemorySize() const;
+
+private:
+  template <class IndexT>
+  struct Links
+  {
+    std::vector<IndexT> offsets;
+    std::vector<IndexT> cellIds;
+  };
+
+  static constexpr size_t k_ScanBlockSize = size_t(1) << 16;
+
+  std::variant<std::monostate, Links<uint32_t>, Links<uint64_t>> m_Links;
+  std::atomic<bool> m_Built{false};
+  std::atomic<const void*> m_ConnectivityStore{nullptr};
+  std::atomic<size_t> m_NumTuples{0};
+  std::mutex m_Mutex;
+
+  /**
+   * @brief Returns true if the links are built for the connectivity store with numTuples
+   * tuples.
+   * @param connectivityStore
+   * @param numTuples
+   * @return bool
+   */
+  bool isBuiltFor(const void* connectivityStore, size_t numTuples) const
+  {
+    return m_Built.load(std::memory_order_acquire) && m_ConnectivityStore.load(std::memory_order_relaxed) == connectivityStore &&
+           m_NumTuples.load(std::memory_order_relaxed) == numTuples;
+  }
+
+  /**
+   * @brief Builds the links with IndexT offsets and cell ids.
+   * @tparam IndexT
+   * @tparam GetCellPointsT
+   * @param numPoints
+   * @param numCells
+   * @param cellSize
+   * @param getCellPoints
+   * @return Links<IndexT>
+   */
+  template <class IndexT, class GetCellPointsT>
+  static Links<IndexT> build(size_t numPoints, size_t numCells, int cellSize, GetCellPointsT& getCellPoints)
+  {
+    Links<IndexT> links;
+    std::unique_ptr<std::atomic<IndexT>[]> cursors(new std::atomic<IndexT>[numPoints]());
+
+    // Count the cells of every point.
+    vtkSMPTools::For(0, static_cast<vtkIdType>(numCells), [&](vtkIdType begin, vtkIdType end) {
+      std::vector<size_t> verts(cellSize);
+      for(vtkIdType cellId = begin; cellId < end; cellId++)
+      {
+        getCellPoints(static_cast<size_t>(cellId), verts.data());
+        for(size_t vert : verts)
+        {
+          if(vert < numPoints)
+          {
+            cursors[vert].fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      }
+    });
+
+    // Block-wise prefix sum, like CV::NeighborListArray::InclusiveScan(): the block
+    // totals are summed in parallel, scanned serially, and then every block is scanned
+    // in parallel from its start offset. The cursors become the first free slot of
+    // every point.
+    links.offsets.resize(numPoints + 1);
+    IndexT* pointOffsets = links.offsets.data();
+    const size_t numBlocks = (numPoints + k_ScanBlockSize - 1) / k_ScanBlockSize;
+    std::vector<IndexT> blockTotals(numBlocks + 1, 0);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(numBlocks), [&](vtkIdType begin, vtkIdType end) {
+      for(size_t block = static_cast<size_t>(begin); block < static_cast<size_t>(end); block++)
+      {
+        const size_t blockEnd = std::min(numPoints, (block + 1) * k_ScanBlockSize);
+        IndexT blockTotal = 0;
+        for(size_t ptId = block * k_ScanBlockSize; ptId < blockEnd; ptId++)
+        {
+          blockTotal += cursors[ptId].load(std::memory_order_relaxed);
+        }
+        blockTotals[block + 1] = blockTotal;
+      }
+    });
+    std::partial_sum(blockTotals.begin(), blockTotals.end(), blockTotals.begin());
+    vtkSMPTools::For(0, static_cast<vtkIdType>(numBlocks), [&](vtkIdType begin, vtkIdType end) {
+      for(size_t block = static_cast<size_t>(begin); block < static_cast<size_t>(end); block++)
+      {
+        const size_t blockEnd = std::min(numPoints, (block + 1) * k_ScanBlockSize);
+        IndexT total = blockTotals[block];
+        for(size_t ptId = block * k_ScanBlockSize; ptId < blockEnd; ptId++)
+        {
+          pointOffsets[ptId] = total;
+          total += cursors[ptId].exchange(total, std::memory_order_relaxed);
+        }
+      }
+    });
+    const IndexT total = blockTotals[numBlocks];
+    pointOffsets[numPoints] = total;
+
+    // Scatter the cell ids.
+    links.cellIds.resize(total);
+    IndexT* cellIds = links.cellIds.data();
+    vtkSMPTools::For(0, static_cast<vtkIdType>(numCells), [&](vtkIdType begin, vtkIdType end) {
+      std::vector<size_t> verts(cellSize);
+      for(vtkIdType cellId = begin; cellId < end; cellId++)
+      {
+        getCellPoints(static_cast<size_t>(cellId), verts.data());
+        for(size_t vert : verts)
+        {
+          if(vert < numPoints)
+          {
+            cellIds[cursors[vert].fetch_add(1, std::memory_order_relaxed)] = static_cast<IndexT>(cellId);
+          }
+        }
+      }
+    });
+
+    // The scatter order depends on the threads. Sorting makes the result deterministic.
+    const IndexT* offsets = links.offsets.data();
+    vtkSMPTools::For(0, static_cast<vtkIdType>(numPoints), [offsets, cellIds](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType ptId = begin; ptId < end; ptId++)
+      {
+        std::sort(cellIds + offsets[ptId], cellIds + offsets[ptId + 1]);
+      }
+    });
+    return links;
+  }
+};
+} // namespace CV
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "complex/DataStructure/AbstractDataStore.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/Utilities/Parsing/HDF5/H5DatasetWriter.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVArrayPool.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::PooledDataStore
+ * @brief The PooledDataStore class is a contiguous in-memory complex data store whose
+ * buffer comes from CV::ArrayPool and goes back to it when the store is destroyed.
+ * The buffer capacity is rounded up to the pool's size class, so reshapeTuples() only
+ * reallocates when the capacity is exceeded. New values are not initialized.
+ *
+ * CV::Array uses it for arrays created by VTK filters under
+ * NewInstancePolicy::PooledComplexArray and accesses it through a raw pointer just
+ * like a complex::DataStore<T>.
+ * @tparam T
+ */
+template <class T>
+class PooledDataStore : public complex::AbstractDataStore<T>
+{
+public:
+  using value_type = typename complex::AbstractDataStore<T>::value_type;
+  using reference = typename complex::AbstractDataStore<T>::reference;
+  using const_reference = typename complex::AbstractDataStore<T>::const_reference;
+  using ShapeType = std::vector<size_t>;
+
+  /**
+   * @brief Acquires a buffer for the given tuple and component shape from CV::ArrayPool.
+   * @param tupleShape
+   * @param componentShape
+   */
+  PooledDataStore(const ShapeType& tupleShape, const ShapeType& componentShape)
+  : m_TupleShape(tupleShape)
+  , m_ComponentShape(componentShape)
+  {
+    reserve(getSize());
+  }
+
+  PooledDataStore(const PooledDataStore&) = delete;
+  PooledDataStore(PooledDataStore&&) noexcept = delete;
+  PooledDataStore& operator=(const PooledDataStore&) = delete;
+  PooledDataStore& operator=(PooledDataStore&&) noexcept = delete;
+
+  /**
+   * @brief Returns the buffer to CV::ArrayPool.
+   */
+  ~PooledDataStore() override
+  {
+    ArrayPool::Release(m_Data, m_CapacityBytes);
+  }
+
+  /**
+   * @brief Returns the number of tuples in the store.
+   * @return size_t
+   */
+  size_t getNumberOfTuples() const override
+  {
+    return std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+  }
+
+  /**
+   * @brief Returns the tuple shape.
+   * @return const ShapeType&
+   */
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+
+  /**
+   * @brief Returns the number of components per tuple.
+   * @return size_t
+   */
+  size_t getNumberOfComponents() const override
+  {
+    return std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+  }
+
+  /**
+   * @brief Returns the component shape.
+   * @return const ShapeType&
+   */
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+
+  /**
+   * @brief The values are held in memory.
+   * @return complex::IDataStore::StoreType
+   */
+  complex::IDataStore::StoreType getStoreType() const override
+  {
+    return complex::IDataStore::StoreType::InMemory;
+  }
+
+  /**
+   * @brief Changes the tuple shape. Existing values are kept. A new buffer is only
+   * acquired if the current capacity is exceeded.
+   * @param tupleShape
+   */
+  void reshapeTuples(const ShapeType& tupleShape) override
+  {
+    const size_t numTuples = std::accumulate(tupleShape.cbegin(), tupleShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+    reserveValues(numTuples * getNumberOfComponents());
+    m_TupleShape = tupleShape;
+  }
+
+  /**
+   * @brief Makes room for at least numValues values without changing the shape, so that
+   * reshapeTuples() does not reallocate until the store grows beyond numValues values.
+   * The whole old capacity is kept, not only getSize() values: CV::Array appends past
+   * the tuple shape and only syncs the shape later.
+   * @param numValues
+   */
+  void reserveValues(size_t numValues)
+  {
+    if(numValues * sizeof(T) <= m_CapacityBytes)
+    {
+      return;
+    }
+    T* oldData = m_Data;
+    const size_t oldCapacityBytes = m_CapacityBytes;
+    m_Data = nullptr;
+    reserve(numValues);
+    if(nullptr != oldData)
+    {
+      std::copy_n(oldData, oldCapacityBytes / sizeof(T), m_Data);
+    }
+    ArrayPool::Release(oldData, oldCapacityBytes);
+  }
+
+  /**
+   * @brief Returns the number of values the buffer can hold.
+   * @return size_t
+   */
+  size_t getCapacity() const
+  {
+    return m_CapacityBytes / sizeof(T);
+  }
+
+  /**
+   * @brief Returns the value at index.
+   * @param index
+   * @return value_type
+   */
+  value_type getValue(size_t index) const override
+  {
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Sets the value at index.
+   * @param index
+   * @param value
+   */
+  void setValue(size_t index, value_type value) override
+  {
+    m_Data[index] = value;
+  }
+
+  /**
+   * @brief Returns the value at index.
+   * @param index
+   * @return const_reference
+   */
+  const_reference operator[](size_t index) const override
+  {
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Returns the value at index.
+   * @param index
+   * @return reference
+   */
+  reference operator[](size_t index) override
+  {
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Returns the value at index. Throws std::runtime_error if index is out of range.
+   * @param index
+   * @return const_reference
+   */
+  const_reference at(size_t index) const override
+  {
+    checkIndex(index);
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Returns the value at index. Throws std::runtime_error if index is out of range.
+   * @param index
+   * @return reference
+   */
+  reference at(size_t index) override
+  {
+    checkIndex(index);
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Copies the values into a new in-memory complex::DataStore<T>.
+   * @return std::unique_ptr<complex::IDataStore>
+   */
+  std::unique_ptr<complex::IDataStore> deepCopy() const override
+  {
+    auto copy = std::make_unique<complex::DataStore<T>>(m_TupleShape, m_ComponentShape);
+    std::copy_n(m_Data, getSize(), copy->data());
+    return copy;
+  }
+
+  /**
+   * @brief Creates a PooledDataStore with the same shape.
+   * @return std::unique_ptr<complex::IDataStore>
+   */
+  std::unique_ptr<complex::IDataStore> createNewInstance() const override
+  {
+    return std::make_unique<PooledDataStore>(m_TupleShape, m_ComponentShape);
+  }
+
+  /**
+   * @brief Writes the values to HDF5 like a complex::DataStore<T>.
+   * @param datasetWriter
+   * @return complex::H5::ErrorType
+   */
+  complex::H5::ErrorType writeHdf5(complex::H5::DatasetWriter& datasetWriter) const override
+  {
+    std::vector<hsize_t> dims;
+    std::copy(m_TupleShape.cbegin(), m_TupleShape.cend(), std::back_inserter(dims));
+    std::copy(m_ComponentShape.cbegin(), m_ComponentShape.cend(), std::back_inserter(dims));
+    return datasetWriter.writeSpan(dims, nonstd::span<const T>(m_Data, getSize()));
+  }
+
+  /**
+   * @brief Returns the start of the values.
+   * @return T*
+   */
+  T* data()
+  {
+    return m_Data;
+  }
+
+  /**
+   * @brief Returns the start of the values.
+   * @return const T*
+   */
+  const T* data() const
+  {
+    return m_Data;
+  }
+
+private:
+  ShapeType m_TupleShape;
+  ShapeType m_ComponentShape;
+  T* m_Data = nullptr;
+  size_t m_CapacityBytes = 0;
+
+  /**
+   * @brief Acquires a buffer for numValues values from the pool.
+   * @param numValues
+   */
+  void reserve(size_t numValues)
+  {
+    m_CapacityBytes = std::max<size_t>(numValues, 1) * sizeof(T);
+    m_Data = static_cast<T*>(ArrayPool::Acquire(m_CapacityBytes));
+  }
+
+  /**
+   * @brief Returns the total number of values.
+   * @return size_t
+   */
+  size_t getSize() const
+  {
+    return getNumberOfTuples() * getNumberOfComponents();
+  }
+
+  /**
+   * @brief Throws std::runtime_error if index is out of range.
+   * @param index
+   */
+  void checkIndex(size_t index) const
+  {
+    if(index >= getSize())
+    {
+      throw std::runtime_error("CV::PooledDataStore::at() index is out of range");
+    }
+  }
+};
+} // namespace CV
@@ -0,0 +1,92 @@
+#include "CVRectGridGeom.hpp"
+
+#include <vtkDataArray.h>
+
+#include "complex/DataStructure/DataArray.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVArray.hpp"
+
+using namespace CV;
+
+namespace
+{
+/**
+ * @brief Wraps a bounds array as a CV::Array<float> holding numValues values. Returns
+ * nullptr if the array is missing, not a single-component float array or has a
+ * different number of values.
+ * @param bounds
+ * @param numValues
+ * @return VTK_PTR(vtkDataArray)
+ */
+VTK_PTR(vtkDataArray) wrapBounds(const complex::DataObject* bounds, size_t numValues)
+{
+  if(bounds == nullptr || bounds->getDataStructure() == nullptr)
+  {
+    return nullptr;
+  }
+  auto boundsArray = std::dynamic_pointer_cast<complex::Float32Array>(bounds->getDataStructure()->getSharedData(bounds->getId()));
+  if(boundsArray == nullptr || boundsArray->getNumberOfComponents() != 1 || boundsArray->getNumberOfTuples() != numValues)
+  {
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkDataArray> coordinates;
+  coordinates.TakeReference(new CV::Array<float>(boundsArray));
+  return coordinates;
+}
+} // namespace
+
+RectGridGeom* RectGridGeom::New()
+{
+  return new RectGridGeom();
+}
+
+void RectGridGeom::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Elements: " << GetNumberOfCells() << endl;
+  os << indent << "NumberOfCells: " << GetNumberOfCells() << endl;
+}
+
+VTK_PTR(vtkDataSet) CV::RectGridGeom::CreateFromGeom(const std::shared_ptr<complex::RectGridGeom>& geom)
+{
+  if(geom == nullptr)
+  {
+    return nullptr;
+  }
+  VTK_NEW(RectGridGeom, dataSet);
+  dataSet->SetGeometry(geom);
+
+  return dataSet;
+}
+
+RectGridGeom::RectGridGeom()
+: vtkRectilinearGrid()
+{
+}
+
+void RectGridGeom::SetGeometry(const std::shared_ptr<complex::RectGridGeom>& rectGridGeom)
+{
+  m_Geom = rectGridGeom;
+  if(rectGridGeom == nullptr)
+  {
+    SetDimensions(0, 0, 0);
+    return;
+  }
+
+  complex::SizeVec3 dims = rectGridGeom->getDimensions();
+  auto xCoordinates = wrapBounds(rectGridGeom->getXBounds(), dims.getX() + 1);
+  auto yCoordinates = wrapBounds(rectGridGeom->getYBounds(), dims.getY() + 1);
+  auto zCoordinates = wrapBounds(rectGridGeom->getZBounds(), dims.getZ() + 1);
+  if(xCoordinates == nullptr || yCoordinates == nullptr || zCoordinates == nullptr)
+  {
+    vtkErrorMacro("RectGridGeom bounds do not match its dimensions");
+    SetDimensions(0, 0, 0);
+    return;
+  }
+
+  SetDimensions(dims.getX() + 1, dims.getY() + 1, dims.getZ() + 1);
+  SetXCoordinates(xCoordinates);
+  SetYCoordinates(yCoordinates);
+  SetZCoordinates(zCoordinates);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+
+#include <vtkRectilinearGrid.h>
+
+#include "complex/DataStructure/Geometry/RectGridGeom.hpp"
+
+#include "complex2VtkLib/VtkBridge/VtkMacros.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::RectGridGeom
+ * @brief This class wraps complex's RectGridGeom as a vtkRectilinearGrid. The X, Y and
+ * Z coordinate arrays are CV::Array<float> views over the geometry's bounds arrays, so
+ * the exact cell boundaries are available without copying or resampling them.
+ */
+class COMPLEX2VTKLIB_EXPORT RectGridGeom : public vtkRectilinearGrid
+{
+public:
+  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<complex::RectGridGeom>& geom);
+  static RectGridGeom* New();
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  vtkTypeMacro(RectGridGeom, vtkRectilinearGrid);
+
+  /**
+   * @brief Sets the complex geometry. The dimensions are set to the number of cells + 1
+   * along each axis and the coordinate arrays to views over the bounds arrays. If a
+   * bounds array is missing or does not hold one value more than the number of cells
+   * along its axis, the grid is left empty.
+   * @param geom
+   */
+  void SetGeometry(const std::shared_ptr<complex::RectGridGeom>& geom);
+
+protected:
+  /**
+   * @brief Default constructor
+   */
+  RectGridGeom();
+
+private:
+  std::shared_ptr<complex::RectGridGeom> m_Geom = nullptr;
+};
+} // namespace CV
@@ -0,0 +1,722 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <vtkSMPTools.h>
+
+#include "complex/DataStructure/AbstractDataStore.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/Utilities/Parsing/HDF5/H5DatasetWriter.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::RunLengthDataStore
+ * @brief The RunLengthDataStore class is a complex data store that keeps its values
+ * run-length encoded in fixed blocks of k_BlockSize values. Label arrays such as
+ * FeatureIds or Phases consist of long runs and shrink by one to two orders of
+ * magnitude.
+ *
+ * getValue() binary-searches the runs of the containing block. When a thread reads
+ * from the same block again, the block is decoded into a per-thread buffer instead,
+ * so sequential and block-local access decodes each block once per thread while
+ * scattered reads never decode a whole block. setValue() re-encodes the affected block.
+ *
+ * operator[] and at() hand out references, which need the values in memory. They
+ * expand the containing block into a pinned decoded buffer that stays valid until
+ * compact(), reshapeTuples() or the destruction of the store. From then on the
+ * expanded block is authoritative: getValue() and setValue() read and write it
+ * directly, and writes through the references are seen by every reader. compact()
+ * re-encodes the expanded blocks and frees their buffers. Prefer getValue() and
+ * setValue() to keep the values compressed. Concurrent reads, including expansion,
+ * are safe; writes must not overlap with other access to the same block.
+ * @tparam T
+ */
+template <class T>
+class RunLengthDataStore final : public complex::AbstractDataStore<T>
+{
+public:
+  using value_type = typename complex::AbstractDataStore<T>::value_type;
+  using reference = typename complex::AbstractDataStore<T>::reference;
+  using const_reference = typename complex::AbstractDataStore<T>::const_reference;
+  using ShapeType = std::vector<size_t>;
+
+  /**
+   * @brief Number of values per encoded block.
+   */
+  static constexpr size_t k_BlockSize = 4096;
+
+  /**
+   * @brief Creates a store of the given shape with all values set to initValue.
+   * @param tupleShape
+   * @param componentShape
+   * @param initValue
+   */
+  RunLengthDataStore(const ShapeType& tupleShape, const ShapeType& componentShape, value_type initValue = {})
+  : m_TupleShape(tupleShape)
+  , m_ComponentShape(componentShape)
+  , m_CacheKey(nextCacheKey())
+  {
+    resizeValues(getSize(), initValue);
+  }
+
+  /**
+   * @brief Copies the values of other. Expanded blocks of other are encoded, so the
+   * copy starts out fully compressed.
+   * @param other
+   */
+  RunLengthDataStore(const RunLengthDataStore& other)
+  : m_TupleShape(other.m_TupleShape)
+  , m_ComponentShape(other.m_ComponentShape)
+  , m_Size(other.m_Size)
+  , m_Blocks(other.m_Blocks)
+  , m_CacheKey(nextCacheKey())
+  {
+    resetExpandedBlocks();
+    for(size_t blockIdx = 0; blockIdx < m_Blocks.size(); blockIdx++)
+    {
+      if(const T* expanded = other.expandedBlock(blockIdx))
+      {
+        m_Blocks[blockIdx] = encodeBlock(expanded, blockSize(blockIdx));
+      }
+    }
+  }
+
+  RunLengthDataStore(RunLengthDataStore&&) noexcept = delete;
+  RunLengthDataStore& operator=(const RunLengthDataStore&) = delete;
+  RunLengthDataStore& operator=(RunLengthDataStore&&) noexcept = delete;
+
+  ~RunLengthDataStore() override
+  {
+    freeExpandedBlocks();
+  }
+
+  /**
+   * @brief Encodes the values of source in parallel.
+   * @param source
+   * @return std::unique_ptr<RunLengthDataStore>
+   */
+  static std::unique_ptr<RunLengthDataStore> Compress(const complex::AbstractDataStore<T>& source)
+  {
+    auto store = std::make_unique<RunLengthDataStore>(source.getTupleShape(), source.getComponentShape());
+    const T* sourceData = CV::GetContiguousData(const_cast<complex::AbstractDataStore<T>*>(&source));
+    const auto numBlocks = static_cast<vtkIdType>(store->m_Blocks.size());
+    vtkSMPTools::For(0, numBlocks, [&store, &source, sourceData](vtkIdType begin, vtkIdType end) {
+      std::vector<T> values;
+      for(vtkIdType blockIdx = begin; blockIdx < end; blockIdx++)
+      {
+        const size_t blockStart = blockIdx * k_BlockSize;
+        const size_t blockCount = store->blockSize(blockIdx);
+        if(sourceData != nullptr)
+        {
+          store->m_Blocks[blockIdx] = encodeBlock(sourceData + blockStart, blockCount);
+          continue;
+        }
+        values.resize(blockCount);
+        for(size_t i = 0; i < blockCount; i++)
+        {
+          values[i] = source.getValue(blockStart + i);
+        }
+        store->m_Blocks[blockIdx] = encodeBlock(values.data(), blockCount);
+      }
+    });
+    return store;
+  }
+
+  /**
+   * @brief Returns the number of tuples in the store.
+   * @return size_t
+   */
+  size_t getNumberOfTuples() const override
+  {
+    return std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+  }
+
+  /**
+   * @brief Returns the tuple shape.
+   * @return const ShapeType&
+   */
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+
+  /**
+   * @brief Returns the number of components per tuple.
+   * @return size_t
+   */
+  size_t getNumberOfComponents() const override
+  {
+    return std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>());
+  }
+
+  /**
+   * @brief Returns the component shape.
+   * @return const ShapeType&
+   */
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+
+  /**
+   * @brief The values are encoded and cannot be addressed as one in-memory buffer.
+   * @return complex::IDataStore::StoreType
+   */
+  complex::IDataStore::StoreType getStoreType() const override
+  {
+    return complex::IDataStore::StoreType::OutOfCore;
+  }
+
+  /**
+   * @brief Changes the tuple shape. Existing values are preserved and new values are
+   * zero initialized. Expanded blocks are compacted first, so references returned by
+   * operator[] and at() become invalid.
+   * @param tupleShape
+   */
+  void reshapeTuples(const ShapeType& tupleShape) override
+  {
+    m_TupleShape = tupleShape;
+    resizeValues(getSize(), value_type{});
+  }
+
+  /**
+   * @brief Returns the value at index.
+   * @param index
+   * @return value_type
+   */
+  value_type getValue(size_t index) const override
+  {
+    const size_t blockIdx = index / k_BlockSize;
+    if(const T* expanded = expandedBlock(blockIdx))
+    {
+      return expanded[index % k_BlockSize];
+    }
+    DecodedBlock& threadBlock = threadDecodedBlock();
+    const uint64_t cacheKey = m_CacheKey.load(std::memory_order_relaxed);
+    const bool decoded = threadBlock.cacheKey == cacheKey && threadBlock.blockIdx == blockIdx;
+    const bool searchedBefore = threadBlock.searchedCacheKey == cacheKey && threadBlock.searchedBlockIdx == blockIdx;
+    if(decoded || searchedBefore)
+    {
+      return decodedBlock(blockIdx)[index % k_BlockSize];
+    }
+    threadBlock.searchedBlockIdx = blockIdx;
+    threadBlock.searchedCacheKey = cacheKey;
+    return findValue(m_Blocks[blockIdx], index % k_BlockSize);
+  }
+
+  /**
+   * @brief Sets the value at index by re-encoding its block, or directly if the block
+   * is expanded.
+   * @param index
+   * @param value
+   */
+  void setValue(size_t index, value_type value) override
+  {
+    const size_t blockIdx = index / k_BlockSize;
+    if(T* expanded = expandedBlock(blockIdx))
+    {
+      expanded[index % k_BlockSize] = value;
+      return;
+    }
+    std::vector<T> values(blockSize(blockIdx));
+    decodeBlock(m_Blocks[blockIdx], values.data());
+    if(values[index % k_BlockSize] == value)
+    {
+      return;
+    }
+    values[index % k_BlockSize] = value;
+    m_Blocks[blockIdx] = encodeBlock(values.data(), values.size());
+    m_CacheKey = nextCacheKey();
+  }
+
+  /**
+   * @brief Returns a reference to the value at index. Expands the containing block,
+   * see the class documentation.
+   * @param index
+   * @return const_reference
+   */
+  const_reference operator[](size_t index) const override
+  {
+    return expandBlock(index / k_BlockSize)[index % k_BlockSize];
+  }
+
+  /**
+   * @brief Returns a writable reference to the value at index. Expands the containing
+   * block, see the class documentation.
+   * @param index
+   * @return reference
+   */
+  reference operator[](size_t index) override
+  {
+    return expandBlock(index / k_BlockSize)[index % k_BlockSize];
+  }
+
+  /**
+   * @brief Returns the value at index. Throws std::runtime_error if index is out of range.
+   * @param index
+   * @return const_reference
+   */
+  const_reference at(size_t index) const override
+  {
+    if(index >= m_Size)
+    {
+      throw std::runtime_error("CV::RunLengthDataStore::at() index is out of range");
+    }
+    return (*this)[index];
+  }
+
+  /**
+   * @brief Returns a writable reference to the value at index. Throws
+   * std::runtime_error if index is out of range.
+   * @param index
+   * @return reference
+   */
+  reference at(size_t index) override
+  {
+    if(index >= m_Size)
+    {
+      throw std::runtime_error("CV::RunLengthDataStore::at() index is out of range");
+    }
+    return (*this)[index];
+  }
+
+  /**
+   * @brief Re-encodes the expanded blocks and frees their buffers. References returned
+   * by operator[] and at() become invalid. Must not overlap with other access.
+   */
+  void compact()
+  {
+    for(size_t blockIdx = 0; blockIdx < m_Blocks.size(); blockIdx++)
+    {
+      T* expanded = m_ExpandedBlocks[blockIdx].exchange(nullptr, std::memory_order_acq_rel);
+      if(expanded != nullptr)
+      {
+        m_Blocks[blockIdx] = encodeBlock(expanded, blockSize(blockIdx));
+        delete[] expanded;
+      }
+    }
+    m_CacheKey = nextCacheKey();
+  }
+
+  /**
+   * @brief Returns the number of blocks expanded by operator[] or at().
+   * @return size_t
+   */
+  size_t getNumberOfExpandedBlocks() const
+  {
+    size_t numExpanded = 0;
+    for(size_t blockIdx = 0; blockIdx < m_Blocks.size(); blockIdx++)
+    {
+      numExpanded += expandedBlock(blockIdx) != nullptr ? 1 : 0;
+    }
+    return numExpanded;
+  }
+
+  /**
+   * @brief Copies the encoded blocks into a new RunLengthDataStore.
+   * @return std::unique_ptr<complex::IDataStore>
+   */
+  std::unique_ptr<complex::IDataStore> deepCopy() const override
+  {
+    return std::make_unique<RunLengthDataStore>(*this);
+  }
+
+  /**
+   * @brief Creates a zero initialized RunLengthDataStore with the same shape.
+   * @return std::unique_ptr<complex::IDataStore>
+   */
+  std::unique_ptr<complex::IDataStore> createNewInstance() const override
+  {
+    return std::make_unique<RunLengthDataStore>(m_TupleShape, m_ComponentShape);
+  }
+
+  /**
+   * @brief Writes the decoded values to HDF5 like a complex::DataStore<T>. The values
+   * are decoded into a temporary buffer first.
+   * @param datasetWriter
+   * @return complex::H5::ErrorType
+   */
+  complex::H5::ErrorType writeHdf5(complex::H5::DatasetWriter& datasetWriter) const override
+  {
+    std::vector<T> values(m_Size);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(m_Blocks.size()), [this, &values](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType blockIdx = begin; blockIdx < end; blockIdx++)
+      {
+        T* output = values.data() + blockIdx * k_BlockSize;
+        if(const T* expanded = expandedBlock(blockIdx))
+        {
+          std::copy_n(expanded, blockSize(blockIdx), output);
+          continue;
+        }
+        decodeBlock(m_Blocks[blockIdx], output);
+      }
+    });
+    std::vector<hsize_t> dims;
+    std::copy(m_TupleShape.cbegin(), m_TupleShape.cend(), std::back_inserter(dims));
+    std::copy(m_ComponentShape.cbegin(), m_ComponentShape.cend(), std::back_inserter(dims));
+    return datasetWriter.writeSpan(dims, nonstd::span<const T>(values.data(), values.size()));
+  }
+
+  /**
+   * @brief Decodes the values [start, start + count) into output.
+   * @param start
+   * @param count
+   * @param output
+   */
+  void copyValues(size_t start, size_t count, T* output) const
+  {
+    while(count > 0)
+    {
+      const size_t blockIdx = start / k_BlockSize;
+      const size_t offset = start % k_BlockSize;
+      const size_t numValues = std::min(count, blockSize(blockIdx) - offset);
+      const T* expanded = expandedBlock(blockIdx);
+      std::copy_n((expanded != nullptr ? expanded : decodedBlock(blockIdx)) + offset, numValues, output);
+      start += numValues;
+      output += numValues;
+      count -= numValues;
+    }
+  }
+
+  /**
+   * @brief Replaces the values [start, start + count) with values. Each affected block
+   * is decoded and re-encoded once, in parallel, instead of once per value as with
+   * setValue(). Expanded blocks are written directly.
+   * @param start
+   * @param count
+   * @param values
+   */
+  void assignValues(size_t start, size_t count, const T* values)
+  {
+    if(count == 0)
+    {
+      return;
+    }
+    const auto firstBlock = static_cast<vtkIdType>(start / k_BlockSize);
+    const auto lastBlock = static_cast<vtkIdType>((start + count - 1) / k_BlockSize);
+    vtkSMPTools::For(firstBlock, lastBlock + 1, [this, start, count, values](vtkIdType begin, vtkIdType end) {
+      std::vector<T> blockValues(k_BlockSize);
+      for(vtkIdType blockIdx = begin; blockIdx < end; blockIdx++)
+      {
+        const size_t blockStart = blockIdx * k_BlockSize;
+        const size_t blockCount = blockSize(blockIdx);
+        const size_t copyStart = std::max(start, blockStart);
+        const size_t copyEnd = std::min(start + count, blockStart + blockCount);
+        if(T* expanded = expandedBlock(blockIdx))
+        {
+          std::copy(values + (copyStart - start), values + (copyEnd - start), expanded + (copyStart - blockStart));
+          continue;
+        }
+        if(copyStart != blockStart || copyEnd != blockStart + blockCount)
+        {
+          decodeBlock(m_Blocks[blockIdx], blockValues.data());
+        }
+        std::copy(values + (copyStart - start), values + (copyEnd - start), blockValues.data() + (copyStart - blockStart));
+        m_Blocks[blockIdx] = encodeBlock(blockValues.data(), blockCount);
+      }
+    });
+    m_CacheKey = nextCacheKey();
+  }
+
+  /**
+   * @brief Returns the number of runs over all blocks that are not expanded.
+   * @return size_t
+   */
+  size_t getNumberOfRuns() const
+  {
+    size_t numRuns = 0;
+    for(size_t blockIdx = 0; blockIdx < m_Blocks.size(); blockIdx++)
+    {
+      numRuns += expandedBlock(blockIdx) == nullptr ? m_Blocks[blockIdx].runValues.size() : 0;
+    }
+    return numRuns;
+  }
+
+  /**
+   * @brief Returns the approximate number of bytes used by the encoded values and the
+   * expanded blocks.
+   * @return size_t
+   */
+  size_t getEncodedSize() const
+  {
+    return m_Blocks.size() * (sizeof(Block) + sizeof(std::atomic<T*>)) + getNumberOfRuns() * (sizeof(T) + sizeof(uint16_t)) + getNumberOfExpandedBlocks() * k_BlockSize * sizeof(T);
+  }
+
+private:
+  /**
+   * @brief One encoded block. Run i holds runValues[i] up to the block-local index
+   * runEnds[i] (exclusive).
+   */
+  struct Block
+  {
+    std::vector<T> runValues;
+    std::vector<uint16_t> runEnds;
+  };
+
+  /**
+   * @brief The block a thread decoded last and the block it last read a single value
+   * from. The cache key changes every time any RunLengthDataStore<T> is created or
+   * written, so a stale entry never matches.
+   */
+  struct DecodedBlock
+  {
+    uint64_t cacheKey = 0;
+    size_t blockIdx = 0;
+    std::vector<T> values;
+    uint64_t searchedCacheKey = 0;
+    size_t searchedBlockIdx = 0;
+  };
+
+  static_assert(k_BlockSize <= 65536, "Run ends are stored as uint16_t");
+
+  ShapeType m_TupleShape;
+  ShapeType m_ComponentShape;
+  size_t m_Size = 0;
+  std::vector<Block> m_Blocks;
+  std::unique_ptr<std::atomic<T*>[]> m_ExpandedBlocks;
+  std::atomic<uint64_t> m_CacheKey;
+
+  /**
+   * @brief Returns a key that is unique among all stores of this value type.
+   * @return uint64_t
+   */
+  static uint64_t nextCacheKey()
+  {
+    static std::atomic<uint64_t> s_CacheKey{0};
+    return ++s_CacheKey;
+  }
+
+  /**
+   * @brief Returns the total number of values.
+   * @return size_t
+   */
+  size_t getSize() const
+  {
+    return getNumberOfTuples() * getNumberOfComponents();
+  }
+
+  /**
+   * @brief Returns the number of values in the block.
+   * @param blockIdx
+   * @return size_t
+   */
+  size_t blockSize(size_t blockIdx) const
+  {
+    return std::min(k_BlockSize, m_Size - blockIdx * k_BlockSize);
+  }
+
+  /**
+   * @brief Returns the pinned decoded values of the block or nullptr if the block is
+   * not expanded.
+   * @param blockIdx
+   * @return T*
+   */
+  T* expandedBlock(size_t blockIdx) const
+  {
+    return m_ExpandedBlocks[blockIdx].load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Returns the pinned decoded values of the block, expanding it first if
+   * needed. If several threads expand the same block, the first buffer published wins.
+   * @param blockIdx
+   * @return T*
+   */
+  T* expandBlock(size_t blockIdx) const
+  {
+    T* expanded = expandedBlock(blockIdx);
+    if(expanded != nullptr)
+    {
+      return expanded;
+    }
+    auto values = std::make_unique<T[]>(k_BlockSize);
+    decodeBlock(m_Blocks[blockIdx], values.get());
+    if(m_ExpandedBlocks[blockIdx].compare_exchange_strong(expanded, values.get(), std::memory_order_acq_rel))
+    {
+      return values.release();
+    }
+    return expanded;
+  }
+
+  /**
+   * @brief Frees the expanded blocks without re-encoding them.
+   */
+  void freeExpandedBlocks()
+  {
+    if(m_ExpandedBlocks == nullptr)
+    {
+      return;
+    }
+    for(size_t blockIdx = 0; blockIdx < m_Blocks.size(); blockIdx++)
+    {
+      delete[] m_ExpandedBlocks[blockIdx].exchange(nullptr);
+    }
+  }
+
+  /**
+   * @brief Allocates one empty expanded block slot per block.
+   */
+  void resetExpandedBlocks()
+  {
+    m_ExpandedBlocks = std::make_unique<std::atomic<T*>[]>(m_Blocks.size());
+    for(size_t blockIdx = 0; blockIdx < m_Blocks.size(); blockIdx++)
+    {
+      m_ExpandedBlocks[blockIdx].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief Returns the calling thread's decoded block.
+   * @return DecodedBlock&
+   */
+  static DecodedBlock& threadDecodedBlock()
+  {
+    static thread_local DecodedBlock s_DecodedBlock;
+    return s_DecodedBlock;
+  }
+
+  /**
+   * @brief Returns the value at the block-local index by binary-searching the run ends.
+   * @param block
+   * @param localIdx
+   * @return T
+   */
+  static T findValue(const Block& block, size_t localIdx)
+  {
+    auto runEnd = std::upper_bound(block.runEnds.cbegin(), block.runEnds.cend(), localIdx, [](size_t idx, uint16_t end) { return idx < end; });
+    return block.runValues[runEnd - block.runEnds.cbegin()];
+  }
+
+  /**
+   * @brief Returns the decoded values of the block from the calling thread's buffer.
+   * @param blockIdx
+   * @return const T*
+   */
+  const T* decodedBlock(size_t blockIdx) const
+  {
+    DecodedBlock& threadBlock = threadDecodedBlock();
+    const uint64_t cacheKey = m_CacheKey.load(std::memory_order_relaxed);
+    if(threadBlock.cacheKey != cacheKey || threadBlock.blockIdx != blockIdx)
+    {
+      threadBlock.values.resize(k_BlockSize);
+      decodeBlock(m_Blocks[blockIdx], threadBlock.values.data());
+      threadBlock.blockIdx = blockIdx;
+      threadBlock.cacheKey = cacheKey;
+    }
+    return threadBlock.values.data();
+  }
+
+  /**
+   * @brief Encodes count values into a block.
+   * @param values
+   * @param count
+   * @return Block
+   */
+  static Block encodeBlock(const T* values, size_t count)
+  {
+    Block block;
+    for(size_t i = 0; i < count; i++)
+    {
+      if(block.runValues.empty() || block.runValues.back() != values[i])
+      {
+        block.runValues.push_back(values[i]);
+        block.runEnds.push_back(0);
+      }
+      block.runEnds.back() = static_cast<uint16_t>(i + 1);
+    }
+    block.runValues.shrink_to_fit();
+    block.runEnds.shrink_to_fit();
+    return block;
+  }
+
+  /**
+   * @brief Decodes all values of the block into output.
+   * @param block
+   * @param output
+   */
+  static void decodeBlock(const Block& block, T* output)
+  {
+    size_t runStart = 0;
+    for(size_t run = 0; run < block.runValues.size(); run++)
+    {
+      std::fill(output + runStart, output + block.runEnds[run], block.runValues[run]);
+      runStart = block.runEnds[run];
+    }
+  }
+
+  /**
+   * @brief Resizes the store to numValues values. Existing values are preserved and new
+   * values are set to initValue.
+   * @param numValues
+   * @param initValue
+   */
+  void resizeValues(size_t numValues, value_type initValue)
+  {
+    if(m_ExpandedBlocks != nullptr)
+    {
+      compact();
+    }
+    std::vector<T> lastBlock;
+    if(!m_Blocks.empty())
+    {
+      lastBlock.resize(blockSize(m_Blocks.size() - 1));
+      decodeBlock(m_Blocks.back(), lastBlock.data());
+    }
+
+    m_Size = numValues;
+    const size_t numBlocks = (numValues + k_BlockSize - 1) / k_BlockSize;
+    const size_t oldNumBlocks = m_Blocks.size();
+    m_Blocks.resize(numBlocks);
+
+    // Re-encode the old last block, which may have been truncated or extended
+    if(oldNumBlocks > 0 && oldNumBlocks <= numBlocks)
+    {
+      lastBlock.resize(blockSize(oldNumBlocks - 1), initValue);
+      m_Blocks[oldNumBlocks - 1] = encodeBlock(lastBlock.data(), lastBlock.size());
+    }
+    else if(numBlocks > 0 && numBlocks < oldNumBlocks)
+    {
+      std::vector<T> values(k_BlockSize);
+      decodeBlock(m_Blocks.back(), values.data());
+      m_Blocks.back() = encodeBlock(values.data(), blockSize(numBlocks - 1));
+    }
+    for(size_t blockIdx = oldNumBlocks; blockIdx < numBlocks; blockIdx++)
+    {
+      m_Blocks[blockIdx].runValues = {initValue};
+      m_Blocks[blockIdx].runEnds = {static_cast<uint16_t>(blockSize(blockIdx))};
+    }
+    resetExpandedBlocks();
+    m_CacheKey = nextCacheKey();
+  }
+};
+
+/**
+ * @brief Replaces the data store of the complex DataArray with a run-length encoded copy
+ * of its values. This must be done before the DataArray is wrapped, because wrappers
+ * cache the data store.
+ * @tparam T
+ * @param dataArray
+ * @return size_t The number of bytes used by the encoded values
+ */
+template <class T>
+size_t CompressDataArray(complex::DataArray<T>& dataArray)
+{
+  std::shared_ptr<RunLengthDataStore<T>> compressedStore = RunLengthDataStore<T>::Compress(*dataArray.getDataStore());
+  const size_t encodedSize = compressedStore->getEncodedSize();
+  dataArray.setDataStore(compressedStore);
+  return encodedSize;
+}
+} // namespace CV
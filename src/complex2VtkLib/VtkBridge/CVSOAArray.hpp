@@ -0,0 +1,231 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "vtkDataArray.h"
+#include "vtkGenericDataArray.h"
+#include "vtkSetGet.h"
+
+#include "complex/DataStructure/AbstractDataStore.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+
+#include "complex2VtkLib/VtkBridge/CVFixedSizeArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::SOAArray
+ * @brief The SOAArray class presents N single-component complex DataArrays of the
+ * same value type and tuple count as one N-component vtkDataArray without copying
+ * or interleaving. Component k of tuple i is read from element i of the k-th
+ * DataArray, directly through its data pointer when the DataArray is backed by a
+ * contiguous store (see CV::IsContiguousStore).
+ *
+ * A typical use is presenting separate X, Y and Z coordinate arrays as vtkPoints
+ * data. The array has a fixed size. Arrays created by VTK through NewInstance()
+ * are plain vtkAOSDataArrayTemplate<T> instances.
+ * @tparam T
+ */
+template <class T>
+class SOAArray : public CV::FixedSizeArray<CV::SOAArray<T>, T>
+{
+public:
+  using SelfType = CV::SOAArray<T>;
+  using ComplexArrayType = complex::DataArray<T>;
+  using ComplexArrayPointerType = std::shared_ptr<ComplexArrayType>;
+  using ValueType = T;
+  using Superclass2 = CV::FixedSizeArray<SelfType, T>;
+
+  vtkAbstractTypeMacroWithNewInstanceType(SelfType, Superclass2, vtkDataArray, typeid(SelfType).name());
+
+  /**
+   * @brief Creates a new instance of CV::SOAArray. This is required of vtkObject derived classes
+   * @return
+   */
+  static SelfType* New()
+  {
+    return new SelfType();
+  }
+
+  /**
+   * @brief
+   */
+  SOAArray()
+  : Superclass()
+  {
+  }
+
+  /**
+   * @brief
+   * @param dataArrays
+   */
+  SOAArray(const std::vector<ComplexArrayPointerType>& dataArrays)
+  : Superclass()
+  {
+    SetComplexArrays(dataArrays);
+  }
+
+  SOAArray(const SOAArray&) = delete;
+  SOAArray(SOAArray&&) noexcept = delete;
+  SOAArray& operator=(const SOAArray&) = delete;
+  SOAArray& operator=(SOAArray&&) noexcept = delete;
+
+  virtual ~SOAArray() = default;
+
+  /**
+   * @brief Sets the complex DataArrays providing the components of this array. Each
+   * DataArray must have a single component and all must have the same number of tuples.
+   * @param dataArrays
+   */
+  void SetComplexArrays(const std::vector<ComplexArrayPointerType>& dataArrays)
+  {
+    for(const auto& dataArray : dataArrays)
+    {
+      if(dataArray == nullptr)
+      {
+        throw std::runtime_error("CV::SOAArray::SetComplexArrays() was given a null complex::DataArray");
+      }
+      if(dataArray->getNumberOfComponents() != 1)
+      {
+        throw std::runtime_error("CV::SOAArray::SetComplexArrays() requires single component complex::DataArrays");
+      }
+      if(dataArray->getNumberOfTuples() != dataArrays.front()->getNumberOfTuples())
+      {
+        throw std::runtime_error("CV::SOAArray::SetComplexArrays() requires complex::DataArrays with the same number of tuples");
+      }
+    }
+
+    m_DataArrays = dataArrays;
+    m_DataStores.clear();
+    m_RawData.clear();
+    m_AllContiguous = !dataArrays.empty();
+    for(const auto& dataArray : m_DataArrays)
+    {
+      complex::AbstractDataStore<T>* dataStore = dataArray->getDataStore();
+      ValueType* rawData = CV::GetContiguousData(dataStore);
+      m_AllContiguous = m_AllContiguous && rawData != nullptr;
+      m_DataStores.push_back(dataStore);
+      m_RawData.push_back(rawData);
+    }
+
+    const vtkIdType numTuples = dataArrays.empty() ? 0 : static_cast<vtkIdType>(dataArrays.front()->getNumberOfTuples());
+    this->NumberOfComponents = dataArrays.empty() ? 1 : static_cast<int>(dataArrays.size());
+    this->Size = numTuples * this->NumberOfComponents;
+    this->MaxId = this->Size - 1;
+  }
+
+  /**
+   * @brief Get the value at valueIdx.
+   * @param valueIdx assumes AOS ordering.
+   * @return T
+   */
+  inline ValueType GetValue(vtkIdType valueIdx) const
+  {
+    const vtkIdType tupleIdx = valueIdx / this->NumberOfComponents;
+    const int compIdx = static_cast<int>(valueIdx % this->NumberOfComponents);
+    return GetTypedComponent(tupleIdx, compIdx);
+  }
+
+  /**
+   * @brief Set the value at valueIdx to value.
+   * @param valueIdx assumes AOS ordering.
+   * @param value
+   */
+  inline void SetValue(vtkIdType valueIdx, ValueType value)
+  {
+    const vtkIdType tupleIdx = valueIdx / this->NumberOfComponents;
+    const int compIdx = static_cast<int>(valueIdx % this->NumberOfComponents);
+    SetTypedComponent(tupleIdx, compIdx, value);
+  }
+
+  /**
+   * @brief Copy the tuple at tupleIdx into tuple.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
+  {
+    for(int i = 0; i < this->NumberOfComponents; i++)
+    {
+      tuple[i] = GetTypedComponent(tupleIdx, i);
+    }
+  }
+
+  /**
+   * @brief Set this array's tuple at tupleIdx to the values in tuple.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
+  {
+    for(int i = 0; i < this->NumberOfComponents; i++)
+    {
+      SetTypedComponent(tupleIdx, i, tuple[i]);
+    }
+  }
+
+  /**
+   * @brief Get component compIdx of the tuple at tupleIdx. This is the fastest way to access SOA data.
+   * @param tupleIdx
+   * @param compIdx
+   * @return T
+   */
+  inline ValueType GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
+  {
+    if(m_AllContiguous)
+    {
+      return m_RawData[compIdx][tupleIdx];
+    }
+    if(m_DataStores.empty())
+    {
+      throw std::runtime_error("CV::SOAArray::GetTypedComponent() does not have underlying complex::DataArrays");
+    }
+    return m_DataStores[compIdx]->getValue(tupleIdx);
+  }
+
+  /**
+   * @brief Set component compIdx of the tuple at tupleIdx to value.
+   * @param tupleIdx
+   * @param compIdx
+   * @param value
+   */
+  inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, ValueType value)
+  {
+    if(m_AllContiguous)
+    {
+      m_RawData[compIdx][tupleIdx] = value;
+      return;
+    }
+    if(m_DataStores.empty())
+    {
+      throw std::runtime_error("CV::SOAArray::SetTypedComponent() does not have underlying complex::DataArrays");
+    }
+    m_DataStores[compIdx]->setValue(tupleIdx, value);
+  }
+
+private:
+  friend class CV::FixedSizeArray<SelfType, T>;
+
+  std::vector<ComplexArrayPointerType> m_DataArrays;
+  std::vector<complex::AbstractDataStore<T>*> m_DataStores;
+  std::vector<ValueType*> m_RawData;
+  bool m_AllContiguous = false;
+
+  /**
+   * @brief Returns the number of tuples of the wrapped arrays, or -1 if none are set.
+   * Used by CV::FixedSizeArray to reject resizing.
+   * @return vtkIdType
+   */
+  vtkIdType getFixedNumberOfTuples() const
+  {
+    return !m_DataArrays.empty() ? static_cast<vtkIdType>(m_DataArrays.front()->getNumberOfTuples()) : -1;
+  }
+};
+} // namespace CV
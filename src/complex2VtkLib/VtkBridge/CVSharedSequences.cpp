@@ -0,0 +1,306 @@
+#include "CVSharedSequences.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vtkIdList.h>
+#include <vtkSMPTools.h>
+#include <vtkVariant.h>
+
+using namespace CV;
+
+namespace
+{
+/**
+ * @brief AOS array whose values alias a shared buffer that it keeps alive.
+ *
+ * Other meshes alias the same buffer, so the virtual vtkDataArray methods that write
+ * values in place first give the array a private copy of its values. Growing the
+ * array reallocates anyway, since VTK does not own the shared buffer. The non-virtual
+ * typed setters and pointers of vtkAOSDataArrayTemplate cannot be intercepted.
+ * @tparam ArrayT
+ */
+template <class ArrayT>
+class SharedBufferArray : public ArrayT
+{
+public:
+  using ValueType = typename ArrayT::ValueType;
+  using BufferType = std::vector<ValueType>;
+
+  vtkTemplateTypeMacro(SharedBufferArray, ArrayT);
+
+  static SharedBufferArray* New()
+  {
+    return new SharedBufferArray();
+  }
+
+  /**
+   * @brief Aliases the first numValues values of the buffer.
+   * @param buffer
+   * @param numValues
+   */
+  void SetBuffer(const std::shared_ptr<BufferType>& buffer, vtkIdType numValues)
+  {
+    // save = 1 keeps VTK from freeing the shared buffer. m_Buffer keeps it alive.
+    this->SetNumberOfComponents(1);
+    this->SetArray(buffer->data(), numValues, 1);
+    m_Buffer = buffer;
+  }
+
+  void* WriteVoidPointer(vtkIdType valueIdx, vtkIdType numValues) override
+  {
+    detach();
+    return Superclass::WriteVoidPointer(valueIdx, numValues);
+  }
+
+  void SetTuple(vtkIdType dstTupleIdx, vtkIdType srcTupleIdx, vtkAbstractArray* source) override
+  {
+    detach();
+    Superclass::SetTuple(dstTupleIdx, srcTupleIdx, source);
+  }
+
+  void SetTuple(vtkIdType tupleIdx, const float* tuple) override
+  {
+    detach();
+    Superclass::SetTuple(tupleIdx, tuple);
+  }
+
+  void SetTuple(vtkIdType tupleIdx, const double* tuple) override
+  {
+    detach();
+    Superclass::SetTuple(tupleIdx, tuple);
+  }
+
+  void InsertTuple(vtkIdType dstTupleIdx, vtkIdType srcTupleIdx, vtkAbstractArray* source) override
+  {
+    detach();
+    Superclass::InsertTuple(dstTupleIdx, srcTupleIdx, source);
+  }
+
+  void InsertTuple(vtkIdType tupleIdx, const float* tuple) override
+  {
+    detach();
+    Superclass::InsertTuple(tupleIdx, tuple);
+  }
+
+  void InsertTuple(vtkIdType tupleIdx, const double* tuple) override
+  {
+    detach();
+    Superclass::InsertTuple(tupleIdx, tuple);
+  }
+
+  void InsertTuples(vtkIdList* dstIds, vtkIdList* srcIds, vtkAbstractArray* source) override
+  {
+    detach();
+    Superclass::InsertTuples(dstIds, srcIds, source);
+  }
+
+  void InsertTuples(vtkIdType dstStart, vtkIdType n, vtkIdType srcStart, vtkAbstractArray* source) override
+  {
+    detach();
+    Superclass::InsertTuples(dstStart, n, srcStart, source);
+  }
+
+  void SetComponent(vtkIdType tupleIdx, int compIdx, double value) override
+  {
+    detach();
+    Superclass::SetComponent(tupleIdx, compIdx, value);
+  }
+
+  void InsertComponent(vtkIdType tupleIdx, int compIdx, double value) override
+  {
+    detach();
+    Superclass::InsertComponent(tupleIdx, compIdx, value);
+  }
+
+  void SetVariantValue(vtkIdType valueIdx, vtkVariant value) override
+  {
+    detach();
+    Superclass::SetVariantValue(valueIdx, value);
+  }
+
+  void InsertVariantValue(vtkIdType valueIdx, vtkVariant value) override
+  {
+    detach();
+    Superclass::InsertVariantValue(valueIdx, value);
+  }
+
+  void Fill(double value) override
+  {
+    detach();
+    Superclass::Fill(value);
+  }
+
+  void FillComponent(int compIdx, double value) override
+  {
+    detach();
+    Superclass::FillComponent(compIdx, value);
+  }
+
+  void DeepCopy(vtkAbstractArray* other) override
+  {
+    detach();
+    Superclass::DeepCopy(other);
+  }
+
+  void DeepCopy(vtkDataArray* other) override
+  {
+    detach();
+    Superclass::DeepCopy(other);
+  }
+
+protected:
+  SharedBufferArray() = default;
+  ~SharedBufferArray() override = default;
+
+private:
+  std::shared_ptr<BufferType> m_Buffer;
+  bool m_Private = false;
+
+  /**
+   * @brief Replaces the shared buffer with a private copy of this array's values.
+   */
+  void detach()
+  {
+    // After growing, VTK already holds its own copy of the values
+    if(m_Private || m_Buffer == nullptr || this->GetPointer(0) != m_Buffer->data())
+    {
+      return;
+    }
+    const vtkIdType numValues = this->GetNumberOfValues();
+    m_Buffer = std::make_shared<BufferType>(m_Buffer->cbegin(), m_Buffer->cbegin() + numValues);
+    this->SetArray(m_Buffer->data(), numValues, 1);
+    m_Private = true;
+  }
+};
+
+using OffsetsBuffer = std::vector<vtkTypeInt64>;
+using CellTypesBuffer = std::vector<unsigned char>;
+
+/**
+ * @brief Cached buffers of CV::SharedSequences. The cache does not own the buffers, so
+ * a buffer is freed with the last array that aliases it.
+ */
+struct SequenceCache
+{
+  std::mutex mutex;
+  std::map<vtkIdType, std::weak_ptr<OffsetsBuffer>> sequences;
+  std::map<unsigned char, std::weak_ptr<CellTypesBuffer>> cellTypes;
+};
+
+SequenceCache& GetSequenceCache()
+{
+  static SequenceCache cache;
+  return cache;
+}
+
+/**
+ * @brief Returns a buffer of at least numValues values for the given key from the
+ * cache. If no cached buffer is alive or it is too small, a new buffer is created with
+ * fillFunc and cached instead. New buffers hold exactly numValues values, so a single
+ * large mesh never costs more than its own sequence. Arrays that alias the smaller
+ * buffer keep it alive until they are deleted.
+ * @param buffers
+ * @param key
+ * @param numValues
+ * @param fillFunc
+ * @return std::shared_ptr<BufferT>
+ */
+template <class BufferT, class KeyT, class FillFuncT>
+std::shared_ptr<BufferT> FindBuffer(std::map<KeyT, std::weak_ptr<BufferT>>& buffers, KeyT key, size_t numValues, FillFuncT&& fillFunc)
+{
+  std::weak_ptr<BufferT>& cachedBuffer = buffers[key];
+  std::shared_ptr<BufferT> buffer = cachedBuffer.lock();
+  if(buffer == nullptr || buffer->size() < numValues)
+  {
+    buffer = std::make_shared<BufferT>(numValues);
+    typename BufferT::value_type* values = buffer->data();
+    vtkSMPTools::For(0, static_cast<vtkIdType>(numValues), [values, &fillFunc](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        values[i] = fillFunc(i);
+      }
+    });
+    cachedBuffer = buffer;
+  }
+  return buffer;
+}
+
+/**
+ * @brief Returns the number of bytes of the cached buffers that are still alive and
+ * drops the entries of freed buffers.
+ * @param buffers
+ * @return size_t
+ */
+template <class BufferT, class KeyT>
+size_t CountLiveBytes(std::map<KeyT, std::weak_ptr<BufferT>>& buffers)
+{
+  size_t bytes = 0;
+  for(auto iter = buffers.begin(); iter != buffers.end();)
+  {
+    if(std::shared_ptr<BufferT> buffer = iter->second.lock())
+    {
+      bytes += buffer->size() * sizeof(typename BufferT::value_type);
+      ++iter;
+    }
+    else
+    {
+      iter = buffers.erase(iter);
+    }
+  }
+  return bytes;
+}
+} // namespace
+
+VTK_PTR(vtkTypeInt64Array) SharedSequences::GetSequence(vtkIdType numValues, vtkIdType step)
+{
+  std::shared_ptr<OffsetsBuffer> buffer;
+  {
+    SequenceCache& cache = GetSequenceCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    buffer = FindBuffer(cache.sequences, step, std::max<size_t>(numValues, 1), [step](vtkIdType i) { return static_cast<vtkTypeInt64>(i * step); });
+  }
+
+  vtkSmartPointer<SharedBufferArray<vtkTypeInt64Array>> sequence;
+  sequence.TakeReference(SharedBufferArray<vtkTypeInt64Array>::New());
+  sequence->SetBuffer(buffer, numValues);
+  return sequence;
+}
+
+VTK_PTR(vtkTypeInt64Array) SharedSequences::GetOffsets(vtkIdType numCells, vtkIdType cellSize)
+{
+  return GetSequence(numCells + 1, cellSize);
+}
+
+VTK_PTR(vtkUnsignedCharArray) SharedSequences::GetCellTypes(vtkIdType numCells, unsigned char cellType)
+{
+  std::shared_ptr<CellTypesBuffer> buffer;
+  {
+    SequenceCache& cache = GetSequenceCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    buffer = FindBuffer(cache.cellTypes, cellType, std::max<size_t>(numCells, 1), [cellType](vtkIdType) { return cellType; });
+  }
+
+  vtkSmartPointer<SharedBufferArray<vtkUnsignedCharArray>> cellTypes;
+  cellTypes.TakeReference(SharedBufferArray<vtkUnsignedCharArray>::New());
+  cellTypes->SetBuffer(buffer, numCells);
+  return cellTypes;
+}
+
+size_t SharedSequences::GetCachedBytes()
+{
+  SequenceCache& cache = GetSequenceCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return CountLiveBytes(cache.sequences) + CountLiveBytes(cache.cellTypes);
+}
+
+void SharedSequences::Clear()
+{
+  SequenceCache& cache = GetSequenceCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.sequences.clear();
+  cache.cellTypes.clear();
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+
+#include <vtkType.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkUnsignedCharArray.h>
+
+#include "complex2VtkLib/VtkBridge/VtkMacros.hpp"
+#include "complex2VtkLib/complex2VtkLib_export.hpp"
+
+namespace CV
+{
+/**
+ * @class CV::SharedSequences
+ * @brief The SharedSequences class provides the offsets 0, k, 2k, ... and constant cell
+ * type arrays of homogeneous meshes without materializing them per mesh. Every array
+ * it returns aliases a prefix of a process-wide buffer, one per step or cell type,
+ * that is filled in parallel when it is needed.
+ *
+ * Cost per mesh: a mesh that fits into the current buffer costs two small VTK array
+ * objects and no values. A larger mesh replaces the cached buffer with one of exactly
+ * its size, 8 bytes per cell for offsets and 1 byte per cell for cell types, as if it
+ * had materialized them. Meshes wrapped earlier keep aliasing the smaller buffer until
+ * they are deleted. Sharing therefore saves memory for the second and later meshes,
+ * not for the largest one. The cache only holds weak references, so a buffer is freed
+ * together with the last array that aliases it.
+ *
+ * vtkCellArray and vtkUnstructuredGrid only accept AOS arrays for offsets and cell
+ * types, so the arrays are a vtkTypeInt64Array and a vtkUnsignedCharArray. Writing to
+ * one of them through the virtual vtkDataArray API first gives it a private copy of its
+ * values, so other meshes are not affected. Writes through the typed pointers, e.g.
+ * GetPointer(), or the non-virtual typed setters cannot be intercepted and must not be
+ * used.
+ */
+class COMPLEX2VTKLIB_EXPORT SharedSequences
+{
+public:
+  SharedSequences() = delete;
+
+  /**
+   * @brief Returns the numValues values 0, step, 2 * step, ...
+   * @param numValues
+   * @param step
+   * @return VTK_PTR(vtkTypeInt64Array)
+   */
+  static VTK_PTR(vtkTypeInt64Array) GetSequence(vtkIdType numValues, vtkIdType step);
+
+  /**
+   * @brief Returns the numCells + 1 vtkCellArray offsets of numCells cells with cellSize
+   * points each.
+   * @param numCells
+   * @param cellSize
+   * @return VTK_PTR(vtkTypeInt64Array)
+   */
+  static VTK_PTR(vtkTypeInt64Array) GetOffsets(vtkIdType numCells, vtkIdType cellSize);
+
+  /**
+   * @brief Returns numCells copies of cellType, e.g. VTK_TETRA.
+   * @param numCells
+   * @param cellType
+   * @return VTK_PTR(vtkUnsignedCharArray)
+   */
+  static VTK_PTR(vtkUnsignedCharArray) GetCellTypes(vtkIdType numCells, unsigned char cellType);
+
+  /**
+   * @brief Returns the number of bytes held by the cached buffers that are still in use.
+   * Older buffers that were replaced by larger ones are not counted.
+   * @return size_t
+   */
+  static size_t GetCachedBytes();
+
+  /**
+   * @brief Forgets the cached buffers, so the next request fills a new buffer. Buffers
+   * still aliased by arrays are freed when the last of those arrays is deleted.
+   */
+  static void Clear();
+};
+} // namespace CV
@@ -1,143 +1,65 @@
 #pragma once
 
+#include <memory>
+
 #include <vtkCellType.h>
-#include <vtkIdTypeArray.h>
-#include <vtkMappedUnstructuredGrid.h>
 
 #include "complex/DataStructure/Geometry/TetrahedralGeom.hpp"
 
-#include "complex2VtkLib/VtkBridge/VtkMacros.hpp"
-#include "complex2VtkLib/complex2VtkLib_export.hpp"
+#include "complex2VtkLib/VtkBridge/CVNodeGeomImpl.hpp"
 
 namespace CV
 {
 /**
- * @class CV::TetrahedralGeom
- * @brief This class is used as an implementation class for vtkMappedUnstructuredGrid to
- * be used with complex's TetrahedralGeom. The implementation maps the cell and point IDs
- * from the complex geometry but the vertex points must be copied into the
- * unstructured grid separately.
+ * @brief Traits of complex's TetrahedralGeom for CV::NodeGeomImpl. The cells are read from
+ * the geometry's tetrahedron list.
  */
-class COMPLEX2VTKLIB_EXPORT TetrahedralGeom : public vtkObject
+struct TetrahedralGeomTraits
 {
-public:
-  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<complex::TetrahedralGeom>& geom);
-  static TetrahedralGeom* New();
-  void PrintSelf(ostream& os, vtkIndent indent) override;
-  vtkTypeMacro(TetrahedralGeom, vtkObject);
-
-  /**
-   * @brief Sets the complex geometry.
-   * @param geom
-   */
-  void SetGeometry(const std::shared_ptr<complex::TetrahedralGeom>& geom);
-
-  /**
-   * @brief Returns the number of cells in the geometry.
-   * @return vtkIdType
-   */
-  vtkIdType GetNumberOfCells();
-
-  /**
-   * @brief Returns the cell type for the given cell ID.
-   * @param cellId
-   * @return int
-   */
-  int GetCellType(vtkIdType cellId);
-
-  /**
-   * @brief Gets a list of point IDs used by the cell ID.
-   * @param cellId
-   * @param ptIds
-   */
-  void GetCellPoints(vtkIdType cellId, vtkIdList* ptIds);
-
-  /**
-   * @brief Gets a list of cell IDs that use the given point ID.
-   * @param ptId
-   * @param cellIds
-   */
-  void GetPointCells(vtkIdType ptId, vtkIdList* cellIds);
-
-  /**
-   * @brief Returns the maximum cell size.
-   * @return int
-   */
-  int GetMaxCellSize();
-
-  /**
-   * @brief Gets a list of all cell IDs of a given type.
-   * @param type
-   * @param array
-   */
-  void GetIdsOfCellsOfType(int type, vtkIdTypeArray* array);
-
-  /**
-   * @brief Returns whether or not all cells are of the same type.
-   * @return int
-   */
-  int IsHomogeneous();
-
-  /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
-   * @param numCells
-   * @param extSize
-   */
-  void Allocate(vtkIdType numCells, int extSize = 1000);
+  using GeomType = complex::TetrahedralGeom;
 
-  /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
-   * @param type
-   * @param ptIds
-   * @return vtkIdType
-   */
-  vtkIdType InsertNextCell(int type, const vtkIdList ptIds[]);
+  static constexpr int k_CellType = VTK_TETRA;
+  static constexpr int k_NumVerts = 4;
 
   /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
-   * @param type
-   * @param npts
-   * @param ptIds
-   * @return vtkIdType
+   * @brief Returns the number of cells.
+   * @param geom
+   * @return size_t
    */
-  vtkIdType InsertNextCell(int type, vtkIdType npts, const vtkIdType ptIds[]);
+  static size_t GetNumberOfCells(complex::TetrahedralGeom& geom)
+  {
+    return geom.getNumberOfElements();
+  }
 
   /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
-   * @param type
-   * @param npts
-   * @param ptIds
-   * @param nfaces
-   * @param faces
-   * @return vtkIdType
+   * @brief Returns the geometry's tetrahedron list.
+   * @param geom
+   * @return std::shared_ptr<complex::UInt64Array>
    */
-  vtkIdType InsertNextCell(int type, vtkIdType npts, const vtkIdType ptIds[], vtkIdType nfaces, const vtkIdType faces[]);
+  static std::shared_ptr<complex::UInt64Array> GetConnectivity(complex::TetrahedralGeom& geom)
+  {
+    return CV::VtkBridge::findConnectivityList(geom.getTetrahedra());
+  }
 
   /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
+   * @brief Writes the 4 point ids of the cell to verts.
+   * @param geom
    * @param cellId
-   * @param npts
-   * @param pts
-   */
-  void ReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[]);
-
-protected:
-  /**
-   * @brief Default constructor
+   * @param verts
    */
-  TetrahedralGeom();
-
-private:
-  std::shared_ptr<complex::TetrahedralGeom> m_Geom = nullptr;
-  float m_MaxCellSize = 0.0f;
-
-  const int CELL_TYPE = VTK_TETRA;
+  static void GetCellVerts(complex::TetrahedralGeom& geom, size_t cellId, size_t* verts)
+  {
+    geom.getVertsAtTet(cellId, verts);
+  }
 };
 
-vtkMakeMappedUnstructuredGrid(CVTetrahedralGrid, TetrahedralGeom);
+/**
+ * @brief vtkMappedUnstructuredGrid implementation for complex's TetrahedralGeom.
+ */
+using TetrahedralGeom = NodeGeomImpl<TetrahedralGeomTraits>;
+
+/**
+ * @brief vtkMappedUnstructuredGrid over a complex TetrahedralGeom.
+ */
+using CVTetrahedralGrid = NodeGrid<TetrahedralGeomTraits>;
 } // namespace CV
@@ -2,142 +2,64 @@
 
 #include <memory>
 
-#include "vtkIdTypeArray.h"
-#include "vtkMappedUnstructuredGrid.h"
+#include <vtkCellType.h>
 
 #include "complex/DataStructure/Geometry/VertexGeom.hpp"
 
-#include "complex2VtkLib/VtkBridge/VtkMacros.hpp"
-#include "complex2VtkLib/complex2VtkLib_export.hpp"
+#include "complex2VtkLib/VtkBridge/CVNodeGeomImpl.hpp"
 
 namespace CV
 {
 /**
- * @class CV::VertexGeom
- * @brief This class is used as an implementation class for vtkMappedUnstructuredGrid to
- * be used with complex's VertexGeom. The implementation maps the cell and point IDs
- * from the complex geometry but the vertex points must be copied into the
- * unstructured grid separately.
+ * @brief Traits of complex's VertexGeom for CV::NodeGeomImpl. Every point is its own vertex
+ * cell.
  */
-class COMPLEX2VTKLIB_EXPORT VertexGeom : public vtkObject
+struct VertexGeomTraits
 {
-public:
-  static VTK_PTR(vtkDataSet) CreateFromGeom(const std::shared_ptr<complex::VertexGeom>& geom);
-  static VertexGeom* New();
-  void PrintSelf(ostream& os, vtkIndent indent) override;
-  vtkTypeMacro(VertexGeom, vtkObject);
+  using GeomType = complex::VertexGeom;
 
-  /**
-   * @brief Sets the complex geometry.
-   * @param geom
-   */
-  void SetGeometry(const std::shared_ptr<complex::VertexGeom>& geom);
-
-  /**
-   * @brief Returns the number of cells in the geometry.
-   * @return vtkIdType
-   */
-  vtkIdType GetNumberOfCells();
-
-  /**
-   * @brief Returns the cell type for the given cell ID.
-   * @param cellId
-   * @return int
-   */
-  int GetCellType(vtkIdType cellId);
-
-  /**
-   * @brief Gets a list of point IDs used by the cell ID.
-   * @param cellId
-   * @param ptIds
-   */
-  void GetCellPoints(vtkIdType cellId, vtkIdList* ptIds);
-
-  /**
-   * @brief Gets a list of cell IDs that use the given point ID.
-   * @param ptId
-   * @param cellIds
-   */
-  void GetPointCells(vtkIdType ptId, vtkIdList* cellIds);
-
-  /**
-   * @brief Returns the maximum cell size.
-   * @return int
-   */
-  int GetMaxCellSize();
-
-  /**
-   * @brief Gets a list of all cell IDs of a given type.
-   * @param type
-   * @param array
-   */
-  void GetIdsOfCellsOfType(int type, vtkIdTypeArray* array);
-
-  /**
-   * @brief Returns whether or not all cells are of the same type.
-   * @return int
-   */
-  int IsHomogeneous();
+  static constexpr int k_CellType = VTK_VERTEX;
+  static constexpr int k_NumVerts = 1;
 
   /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
-   * @param numCells
-   * @param extSize
-   */
-  void Allocate(vtkIdType numCells, int extSize = 1000);
-
-  /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
-   * @param type
-   * @param ptIds
-   * @return vtkIdType
-   */
-  vtkIdType InsertNextCell(int type, const vtkIdList ptIds[]);
-
-  /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
-   * @param type
-   * @param npts
-   * @param ptIds
-   * @return vtkIdType
+   * @brief Returns the number of cells.
+   * @param geom
+   * @return size_t
    */
-  vtkIdType InsertNextCell(int type, vtkIdType npts, const vtkIdType ptIds[]);
+  static size_t GetNumberOfCells(complex::VertexGeom& geom)
+  {
+    return geom.getNumberOfElements();
+  }
 
   /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
-   * @param type
-   * @param npts
-   * @param ptIds
-   * @param nfaces
-   * @param faces
-   * @return vtkIdType
+   * @brief Vertex geometries have no connectivity list. Every point is its own cell.
+   * @param geom
+   * @return std::shared_ptr<complex::UInt64Array>
    */
-  vtkIdType InsertNextCell(int type, vtkIdType npts, const vtkIdType ptIds[], vtkIdType nfaces, const vtkIdType faces[]);
+  static std::shared_ptr<complex::UInt64Array> GetConnectivity(complex::VertexGeom& geom)
+  {
+    return nullptr;
+  }
 
   /**
-   * @brief Required by vtkMappedUnstructuredGrid but should not be called on
-   * this read-only implementation.
+   * @brief Writes the point id of the cell, which is the cell id, to verts.
+   * @param geom
    * @param cellId
-   * @param npts
-   * @param pts
-   */
-  void ReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[]);
-
-protected:
-  /**
-   * @brief Default constructor
+   * @param verts
    */
-  VertexGeom();
-
-private:
-  std::shared_ptr<complex::VertexGeom> m_Geom = nullptr;
-  float m_MaxCellSize = 0.0f;
-  const int CELL_TYPE = VTK_VERTEX;
+  static void GetCellVerts(complex::VertexGeom& geom, size_t cellId, size_t* verts)
+  {
+    verts[0] = cellId;
+  }
 };
 
-vtkMakeMappedUnstructuredGrid(CVVertexGrid, VertexGeom);
+/**
+ * @brief vtkMappedUnstructuredGrid implementation for complex's VertexGeom.
+ */
+using VertexGeom = NodeGeomImpl<VertexGeomTraits>;
+
+/**
+ * @brief vtkMappedUnstructuredGrid over a complex VertexGeom.
+ */
+using CVVertexGrid = NodeGrid<VertexGeomTraits>;
 } // namespace CV
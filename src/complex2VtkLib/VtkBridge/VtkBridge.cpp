@@ -1,18 +1,32 @@
 #include "VtkBridge.hpp"
 
+#include <cmath>
+#include <type_traits>
+
 #include "vtkCellData.h"
+#include "vtkFieldData.h"
 
 #include "complex/DataStructure/Geometry/AbstractGeometry.hpp"
 #include "complex/DataStructure/DataArray.hpp"
 #include "complex/DataStructure/Geometry/ImageGeom.hpp"
 #include "complex/DataStructure/Geometry/LinkedGeometryData.hpp"
+#include "complex/DataStructure/NeighborList.hpp"
 
 
 
 #include "complex2VtkLib/VtkBridge/CVArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVCellArrayGeom.hpp"
+#include "complex2VtkLib/VtkBridge/CVComponentView.hpp"
+#include "complex2VtkLib/VtkBridge/CVComputedArray.hpp"
 #include "complex2VtkLib/VtkBridge/CVEdgeGeom.hpp"
+#include "complex2VtkLib/VtkBridge/CVFeatureGatherArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVHexahedralGeom.hpp"
 #include "complex2VtkLib/VtkBridge/CVImageGeom.hpp"
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+#include "complex2VtkLib/VtkBridge/CVNeighborListArray.hpp"
 #include "complex2VtkLib/VtkBridge/CVQuadGeom.hpp"
+#include "complex2VtkLib/VtkBridge/CVRectGridGeom.hpp"
+#include "complex2VtkLib/VtkBridge/CVSOAArray.hpp"
 #include "complex2VtkLib/VtkBridge/CVTetrahedralGeom.hpp"
 #include "complex2VtkLib/VtkBridge/CVTriangleGeom.hpp"
 #include "complex2VtkLib/VtkBridge/CVVertexGeom.hpp"
@@ -139,6 +153,140 @@ std::vector<complex::DataObject::IdType> findDataArrays(const std::shared_ptr<co
   return ids;
 }
 
+/**
+ * @brief Wraps the DataArray in the CV::Array instantiation matching its number of
+ * components. Scalars, RGB colors / vertex coordinates, quaternions and tensors use
+ * a compile-time component count. All other component counts are handled at runtime.
+ * The selected instantiations must be kept in sync with CV::Dispatch::CVArrays.
+ * @param dataArray
+ * @return vtkDataArray*
+ */
+template <typename T>
+vtkDataArray* wrapTypedDataArray(const std::shared_ptr<complex::DataArray<T>>& dataArray)
+{
+  switch(dataArray->getNumberOfComponents())
+  {
+  case 1:
+    return new CV::Array<T, 1>(dataArray);
+  case 3:
+    return new CV::Array<T, 3>(dataArray);
+  case 4:
+    return new CV::Array<T, 4>(dataArray);
+  case 9:
+    return new CV::Array<T, 9>(dataArray);
+  default:
+    return new CV::Array<T>(dataArray);
+  }
+}
+
+/**
+ * @brief Calls func with the DataObject cast to the matching std::shared_ptr<complex::DataArray<T>>
+ * for every value type supported by wrapDataArray. Returns nullptr if the DataObject is not
+ * one of those DataArray types.
+ * @param dataObject
+ * @param func
+ * @return vtkDataArray*
+ */
+template <typename FuncT>
+vtkDataArray* visitDataArray(const std::shared_ptr<complex::DataObject>& dataObject, FuncT&& func)
+{
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<int8_t>>(dataObject))
+  {
+    return func(castArr);
+  }
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<int16_t>>(dataObject))
+  {
+    return func(castArr);
+  }
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<int32_t>>(dataObject))
+  {
+    return func(castArr);
+  }
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<int64_t>>(dataObject))
+  {
+    return func(castArr);
+  }
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<uint8_t>>(dataObject))
+  {
+    return func(castArr);
+  }
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<uint16_t>>(dataObject))
+  {
+    return func(castArr);
+  }
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<uint32_t>>(dataObject))
+  {
+    return func(castArr);
+  }
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<uint64_t>>(dataObject))
+  {
+    return func(castArr);
+  }
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<float>>(dataObject))
+  {
+    return func(castArr);
+  }
+  if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<double>>(dataObject))
+  {
+    return func(castArr);
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Calls func with the DataObject cast to the matching std::shared_ptr<complex::NeighborList<T>>
+ * for the same value types as visitDataArray. Returns nullptr if the DataObject is not one of
+ * those NeighborList types.
+ * @param dataObject
+ * @param func
+ * @return vtkDataArray*
+ */
+template <typename FuncT>
+vtkDataArray* visitNeighborList(const std::shared_ptr<complex::DataObject>& dataObject, FuncT&& func)
+{
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<int8_t>>(dataObject))
+  {
+    return func(castList);
+  }
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<int16_t>>(dataObject))
+  {
+    return func(castList);
+  }
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<int32_t>>(dataObject))
+  {
+    return func(castList);
+  }
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<int64_t>>(dataObject))
+  {
+    return func(castList);
+  }
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<uint8_t>>(dataObject))
+  {
+    return func(castList);
+  }
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<uint16_t>>(dataObject))
+  {
+    return func(castList);
+  }
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<uint32_t>>(dataObject))
+  {
+    return func(castList);
+  }
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<uint64_t>>(dataObject))
+  {
+    return func(castList);
+  }
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<float>>(dataObject))
+  {
+    return func(castList);
+  }
+  if(auto castList = std::dynamic_pointer_cast<complex::NeighborList<double>>(dataObject))
+  {
+    return func(castList);
+  }
+  return nullptr;
+}
+
 std::vector<VTK_PTR(vtkDataSet)> CV::VtkBridge::wrapDataStructure(const complex::DataStructure& ds)
 {
   std::vector<VTK_PTR(vtkDataSet)> wrappedGeoms;
@@ -152,12 +300,58 @@ std::vector<VTK_PTR(vtkDataSet)> CV::VtkBridge::wrapDataStructure(const complex:
   return wrappedGeoms;
 }
 
-VTK_PTR(vtkDataSet) CV::VtkBridge::wrapGeometry(const std::shared_ptr<complex::AbstractGeometry>& geom)
+/**
+ * @brief Wraps node geometries with CV::CellArrayGeom. Returns nullptr if the geometry
+ * is not supported or its connectivity list cannot be aliased.
+ * @param geom
+ * @return VTK_PTR(vtkDataSet)
+ */
+VTK_PTR(vtkDataSet) wrapCellArrayGeometry(const std::shared_ptr<complex::AbstractGeometry>& geom)
+{
+  if(auto edge = std::dynamic_pointer_cast<complex::EdgeGeom>(geom))
+  {
+    return CV::CellArrayGeom::CreateFromGeom(edge);
+  }
+  if(auto hexahedral = std::dynamic_pointer_cast<complex::HexahedralGeom>(geom))
+  {
+    return CV::CellArrayGeom::CreateFromGeom(hexahedral);
+  }
+  if(auto quad = std::dynamic_pointer_cast<complex::QuadGeom>(geom))
+  {
+    return CV::CellArrayGeom::CreateFromGeom(quad);
+  }
+  if(auto tetrahedral = std::dynamic_pointer_cast<complex::TetrahedralGeom>(geom))
+  {
+    return CV::CellArrayGeom::CreateFromGeom(tetrahedral);
+  }
+  if(auto tri = std::dynamic_pointer_cast<complex::TriangleGeom>(geom))
+  {
+    return CV::CellArrayGeom::CreateFromGeom(tri);
+  }
+  if(auto verts = std::dynamic_pointer_cast<complex::VertexGeom>(geom))
+  {
+    return CV::CellArrayGeom::CreateFromGeom(verts);
+  }
+  return nullptr;
+}
+
+VTK_PTR(vtkDataSet) CV::VtkBridge::wrapGeometry(const std::shared_ptr<complex::AbstractGeometry>& geom, GeometryWrapMode mode)
 {
+  if(mode == GeometryWrapMode::CellArray)
+  {
+    if(auto cellArrayGeom = wrapCellArrayGeometry(geom))
+    {
+      return cellArrayGeom;
+    }
+  }
   if(auto edge = std::dynamic_pointer_cast<complex::EdgeGeom>(geom))
   {
     return CV::EdgeGeom::CreateFromGeom(edge);
   }
+  if(auto hexahedral = std::dynamic_pointer_cast<complex::HexahedralGeom>(geom))
+  {
+    return CV::HexahedralGeom::CreateFromGeom(hexahedral);
+  }
   if(auto image = std::dynamic_pointer_cast<complex::ImageGeom>(geom))
   {
     return CV::ImageGeom::CreateFromGeom(image);
@@ -166,6 +360,10 @@ VTK_PTR(vtkDataSet) CV::VtkBridge::wrapGeometry(const std::shared_ptr<complex::A
   {
     return CV::QuadGeom::CreateFromGeom(quad);
   }
+  if(auto rectGrid = std::dynamic_pointer_cast<complex::RectGridGeom>(geom))
+  {
+    return CV::RectGridGeom::CreateFromGeom(rectGrid);
+  }
   if(auto tetrahedral = std::dynamic_pointer_cast<complex::TetrahedralGeom>(geom))
   {
     return CV::TetrahedralGeom::CreateFromGeom(tetrahedral);
@@ -181,32 +379,83 @@ VTK_PTR(vtkDataSet) CV::VtkBridge::wrapGeometry(const std::shared_ptr<complex::A
   return nullptr;
 }
 
-VTK_PTR(vtkDataSet) CV::VtkBridge::wrapGeometryWithArrays(const std::shared_ptr<complex::AbstractGeometry>& geom)
+VTK_PTR(vtkDataSet) CV::VtkBridge::wrapGeometryWithArrays(const std::shared_ptr<complex::AbstractGeometry>& geom, bool includeFeatureArrays, GeometryWrapMode mode)
 {
-  vtkSmartPointer<vtkDataSet> wrappedGeom = wrapGeometry(geom);
+  vtkSmartPointer<vtkDataSet> wrappedGeom = wrapGeometry(geom, mode);
+  if(wrappedGeom == nullptr)
+  {
+    return nullptr;
+  }
   const size_t geomTupleCount = geom->getNumberOfElements();
   const complex::DataStructure* dataStructure = geom->getDataStructure();
+  vtkCellData* cellData = wrappedGeom->GetCellData();
+
+  std::shared_ptr<complex::DataObject> featureIds;
+  std::vector<std::shared_ptr<complex::DataObject>> featureArrayCandidates;
 
   complex::LinkedGeometryData& geomData = geom->getLinkedGeometryData();
   std::set<complex::DataPath> dataPaths = geomData.getCellDataPaths();
   for(const auto& dataPath : dataPaths)
   {
     complex::DataObject::IdType objectId = dataStructure->getId(dataPath).value();
-    vtkDataArray* wrappedArray = wrapDataArray(*dataStructure, objectId);
+    vtkSmartPointer<vtkDataArray> wrappedArray;
+    wrappedArray.TakeReference(wrapDataArray(*dataStructure, objectId));
     if(wrappedArray == nullptr)
     {
       continue;
     }
     if(geomTupleCount != wrappedArray->GetNumberOfTuples())
     {
+      featureArrayCandidates.push_back(dataStructure->getSharedData(objectId));
       continue;
     }
+    if(wrappedArray->GetName() == k_FeatureIdsArrayName)
+    {
+      featureIds = dataStructure->getSharedData(objectId);
+    }
 
-    vtkCellData* cellData = wrappedGeom->GetCellData();
     cellData->AddArray(wrappedArray);
     cellData->SetActiveScalars(wrappedArray->GetName());
   }
 
+  if(!includeFeatureArrays || featureIds == nullptr || featureArrayCandidates.empty())
+  {
+    return wrappedGeom;
+  }
+
+  // Only feature arrays that every feature id can index are gathered. A feature array
+  // has at most one tuple per cell plus the unused feature 0, so larger arrays are not
+  // feature arrays of this geometry. The range of the wrapped FeatureIds array is
+  // computed in parallel and cached.
+  double featureIdRange[2] = {0.0, -1.0};
+  if(vtkDataArray* wrappedFeatureIds = cellData->GetArray(k_FeatureIdsArrayName.c_str()))
+  {
+    wrappedFeatureIds->GetRange(featureIdRange, 0);
+  }
+  if(featureIdRange[0] < 0.0)
+  {
+    return wrappedGeom;
+  }
+  for(const auto& featureArray : featureArrayCandidates)
+  {
+    auto iFeatureArray = std::dynamic_pointer_cast<complex::IDataArray>(featureArray);
+    if(iFeatureArray == nullptr)
+    {
+      continue;
+    }
+    const size_t numFeatureTuples = iFeatureArray->getNumberOfTuples();
+    if(numFeatureTuples == 0 || numFeatureTuples > geomTupleCount + 1 || featureIdRange[1] >= static_cast<double>(numFeatureTuples))
+    {
+      continue;
+    }
+    vtkSmartPointer<vtkDataArray> gatherArray;
+    gatherArray.TakeReference(wrapFeatureArray(featureIds, featureArray));
+    if(gatherArray != nullptr)
+    {
+      cellData->AddArray(gatherArray);
+    }
+  }
+
   return wrappedGeom;
 }
 
@@ -225,44 +474,259 @@ vtkDataArray* CV::VtkBridge::wrapDataArray(const std::shared_ptr<complex::DataOb
 
   if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<int8_t>>(dataArray))
   {
-    return new CV::Array<int8_t>(castArr);
+    return wrapTypedDataArray<int8_t>(castArr);
   }
   else if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<int16_t>>(dataArray))
   {
-    return new CV::Array<int16_t>(castArr);
+    return wrapTypedDataArray<int16_t>(castArr);
   }
   else if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<int32_t>>(dataArray))
   {
-    return new CV::Array<int32_t>(castArr);
+    return wrapTypedDataArray<int32_t>(castArr);
   }
   else if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<int64_t>>(dataArray))
   {
-    return new CV::Array<int64_t>(castArr);
+    return wrapTypedDataArray<int64_t>(castArr);
   }
   else if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<uint8_t>>(dataArray))
   {
-    return new CV::Array<uint8_t>(castArr);
+    return wrapTypedDataArray<uint8_t>(castArr);
   }
   else if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<uint16_t>>(dataArray))
   {
-    return new CV::Array<uint16_t>(castArr);
+    return wrapTypedDataArray<uint16_t>(castArr);
   }
   else if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<uint32_t>>(dataArray))
   {
-    return new CV::Array<uint32_t>(castArr);
+    return wrapTypedDataArray<uint32_t>(castArr);
   }
   else if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<uint64_t>>(dataArray))
   {
-    return new CV::Array<uint64_t>(castArr);
+    return wrapTypedDataArray<uint64_t>(castArr);
   }
   else if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<float>>(dataArray))
   {
-    return new CV::Array<float>(castArr);
+    return wrapTypedDataArray<float>(castArr);
   }
   else if(auto castArr = std::dynamic_pointer_cast<complex::DataArray<double>>(dataArray))
   {
-    return new CV::Array<double>(castArr);
+    return wrapTypedDataArray<double>(castArr);
   }
 
   return nullptr;
 }
+
+vtkDataArray* CV::VtkBridge::wrapDataArrayComponent(const std::shared_ptr<complex::DataObject>& dataArray, int component)
+{
+  return visitDataArray(dataArray, [component](const auto& castArr) -> vtkDataArray* {
+    using ValueType = typename std::decay_t<decltype(*castArr)>::value_type;
+    if(component < 0 || component >= static_cast<int>(castArr->getNumberOfComponents()))
+    {
+      return nullptr;
+    }
+    return new CV::ComponentView<ValueType>(castArr, component);
+  });
+}
+
+std::vector<std::string> CV::VtkBridge::addComponentViews(vtkFieldData* fieldData, const std::shared_ptr<complex::DataObject>& dataArray)
+{
+  std::vector<std::string> viewNames;
+  auto iDataArray = std::dynamic_pointer_cast<complex::IDataArray>(dataArray);
+  if(fieldData == nullptr || iDataArray == nullptr)
+  {
+    return viewNames;
+  }
+
+  const auto numComps = static_cast<int>(iDataArray->getNumberOfComponents());
+  for(int component = 0; component < numComps; component++)
+  {
+    vtkSmartPointer<vtkDataArray> view;
+    view.TakeReference(wrapDataArrayComponent(dataArray, component));
+    if(view == nullptr)
+    {
+      break;
+    }
+    fieldData->AddArray(view);
+    viewNames.push_back(view->GetName());
+  }
+  return viewNames;
+}
+
+vtkDataArray* CV::VtkBridge::wrapDataArrays(const complex::DataStructure& dataStructure, const std::vector<complex::DataObject::IdType>& arrayIds)
+{
+  if(arrayIds.empty())
+  {
+    return nullptr;
+  }
+
+  std::vector<std::shared_ptr<complex::DataObject>> dataObjects;
+  for(const auto& arrayId : arrayIds)
+  {
+    auto dataObject = dataStructure.getSharedData(arrayId);
+    if(dataObject == nullptr)
+    {
+      return nullptr;
+    }
+    dataObjects.push_back(dataObject);
+  }
+
+  // The first array determines the value type. All others must match it.
+  return visitDataArray(dataObjects.front(), [&dataObjects](const auto& firstArray) -> vtkDataArray* {
+    using ComplexArrayType = std::decay_t<decltype(*firstArray)>;
+    using ValueType = typename ComplexArrayType::value_type;
+
+    std::string name;
+    std::vector<std::shared_ptr<ComplexArrayType>> componentArrays;
+    for(const auto& dataObject : dataObjects)
+    {
+      auto componentArray = std::dynamic_pointer_cast<ComplexArrayType>(dataObject);
+      if(componentArray == nullptr || componentArray->getNumberOfComponents() != 1 || componentArray->getNumberOfTuples() != firstArray->getNumberOfTuples())
+      {
+        return nullptr;
+      }
+      name += (name.empty() ? "" : "_") + componentArray->getName();
+      componentArrays.push_back(componentArray);
+    }
+
+    auto* soaArray = new CV::SOAArray<ValueType>(componentArrays);
+    soaArray->SetName(name.c_str());
+    return soaArray;
+  });
+}
+
+VTK_PTR(vtkPoints) CV::VtkBridge::wrapVertexList(const complex::DataObject* vertexList)
+{
+  if(vertexList == nullptr || vertexList->getDataStructure() == nullptr)
+  {
+    return nullptr;
+  }
+  auto vertices = std::dynamic_pointer_cast<complex::Float32Array>(vertexList->getDataStructure()->getSharedData(vertexList->getId()));
+  if(vertices == nullptr || vertices->getNumberOfComponents() != 3)
+  {
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkDataArray> pointData;
+  pointData.TakeReference(new CV::Array<float, 3>(vertices));
+  VTK_NEW(vtkPoints, points);
+  points->SetData(pointData);
+  return points;
+}
+
+std::shared_ptr<complex::UInt64Array> CV::VtkBridge::findConnectivityList(const complex::DataObject* connectivityList)
+{
+  if(connectivityList == nullptr || connectivityList->getDataStructure() == nullptr)
+  {
+    return nullptr;
+  }
+  return std::dynamic_pointer_cast<complex::UInt64Array>(connectivityList->getDataStructure()->getSharedData(connectivityList->getId()));
+}
+
+vtkDataArray* CV::VtkBridge::wrapNeighborList(const std::shared_ptr<complex::DataObject>& neighborList, VTK_PTR(vtkIdTypeArray)* offsets)
+{
+  return visitNeighborList(neighborList, [offsets](const auto& castList) -> vtkDataArray* {
+    using ValueType = typename std::decay_t<decltype(*castList)>::value_type;
+    auto* listArray = new CV::NeighborListArray<ValueType>(castList);
+    if(offsets != nullptr)
+    {
+      *offsets = listArray->GetOffsetsArray();
+    }
+    return listArray;
+  });
+}
+
+bool CV::VtkBridge::addNeighborList(vtkFieldData* fieldData, const std::shared_ptr<complex::DataObject>& neighborList)
+{
+  if(fieldData == nullptr)
+  {
+    return false;
+  }
+
+  VTK_PTR(vtkIdTypeArray) offsets;
+  vtkSmartPointer<vtkDataArray> values;
+  values.TakeReference(wrapNeighborList(neighborList, &offsets));
+  if(values == nullptr)
+  {
+    return false;
+  }
+  fieldData->AddArray(values);
+  fieldData->AddArray(offsets);
+  return true;
+}
+
+vtkDataArray* CV::VtkBridge::wrapFeatureArray(const std::shared_ptr<complex::DataObject>& featureIds, const std::shared_ptr<complex::DataObject>& featureArray)
+{
+  auto castFeatureIds = std::dynamic_pointer_cast<complex::DataArray<int32_t>>(featureIds);
+  if(castFeatureIds == nullptr || castFeatureIds->getNumberOfComponents() != 1)
+  {
+    return nullptr;
+  }
+  return visitDataArray(featureArray, [&castFeatureIds](const auto& castArr) -> vtkDataArray* {
+    using ValueType = typename std::decay_t<decltype(*castArr)>::value_type;
+    auto* gatherArray = new CV::FeatureGatherArray<ValueType>(castFeatureIds, castArr);
+    if(!gatherArray->HasValidFeatureIds())
+    {
+      gatherArray->Delete();
+      return nullptr;
+    }
+    return gatherArray;
+  });
+}
+
+vtkDataArray* CV::VtkBridge::wrapMagnitude(const std::shared_ptr<complex::DataObject>& dataArray)
+{
+  return visitDataArray(dataArray, [](const auto& castArr) -> vtkDataArray* {
+    const auto numComps = static_cast<vtkIdType>(castArr->getNumberOfComponents());
+    auto kernel = [castArr, numComps](vtkIdType beginTuple, vtkIdType endTuple, double* output) {
+      auto* dataStore = castArr->getDataStore();
+      const auto* rawData = CV::GetContiguousData(dataStore);
+      for(vtkIdType tupleIdx = beginTuple; tupleIdx < endTuple; tupleIdx++)
+      {
+        double squaredNorm = 0.0;
+        for(vtkIdType comp = 0; comp < numComps; comp++)
+        {
+          const vtkIdType valueIdx = tupleIdx * numComps + comp;
+          const auto value = static_cast<double>(rawData != nullptr ? rawData[valueIdx] : dataStore->getValue(valueIdx));
+          squaredNorm += value * value;
+        }
+        output[tupleIdx - beginTuple] = std::sqrt(squaredNorm);
+      }
+    };
+    auto* magnitude = new CV::ComputedArray<double>(static_cast<vtkIdType>(castArr->getNumberOfTuples()), 1, kernel);
+    magnitude->SetName((castArr->getName() + "_Magnitude").c_str());
+    return magnitude;
+  });
+}
+
+template <class T>
+vtkDataArray* CV::VtkBridge::wrapRawFile(const std::filesystem::path& filePath, const std::string& name, complex::DataStructure& dataStructure, const std::vector<size_t>& tupleDims,
+                                         const std::vector<size_t>& compDims, const std::optional<complex::DataObject::IdType>& parentId)
+{
+  auto* dataArray = CV::CreateMappedDataArray<T>(filePath, name, dataStructure, tupleDims, compDims, parentId);
+  if(dataArray == nullptr)
+  {
+    return nullptr;
+  }
+  return wrapDataArray(dataStructure, dataArray->getId());
+}
+
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<int8_t>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<int16_t>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<int32_t>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<int64_t>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<uint8_t>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<uint16_t>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<uint32_t>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<uint64_t>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<float>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
+template COMPLEX2VTKLIB_EXPORT vtkDataArray* CV::VtkBridge::wrapRawFile<double>(const std::filesystem::path&, const std::string&, complex::DataStructure&, const std::vector<size_t>&, const std::vector<size_t>&,
+                                                                     const std::optional<complex::DataObject::IdType>&);
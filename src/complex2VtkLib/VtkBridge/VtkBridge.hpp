@@ -1,12 +1,19 @@
 #pragma once
 
+#include <filesystem>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
+#include <vtkFieldData.h>
+#include <vtkIdTypeArray.h>
 #include <vtkObject.h>
+#include <vtkPoints.h>
 
+#include "complex/DataStructure/DataArray.hpp"
 #include "complex/DataStructure/DataStructure.hpp"
 
 #include "complex2VtkLib/VtkBridge/VtkMacros.hpp"
@@ -31,17 +38,39 @@ namespace VtkBridge
  */
 COMPLEX2VTKLIB_EXPORT std::vector<VTK_PTR(vtkDataSet)> wrapDataStructure(const complex::DataStructure& dataStructure);
 
+/**
+ * @brief Selects how node geometries are presented to VTK.
+ */
+enum class GeometryWrapMode
+{
+  /** @brief vtkMappedUnstructuredGrid wrappers that query the complex geometry for every cell. */
+  Mapped,
+  /** @brief Native vtkPolyData / vtkUnstructuredGrid whose vtkCellArray aliases the complex connectivity list (see CV::CellArrayGeom). */
+  CellArray
+};
+
 /**
  * @brief Attempts to create a vtkObject wrapping the specified complex geometry.
  * A std::shared_ptr to the geometry is stored in the wrapped geometry, preventing
  * it from being cleaned up if the DataStructure goes out of scope before the
  * vtkObject does.
  *
+ * With GeometryWrapMode::CellArray, vertex, edge, triangle, quad, tetrahedral and
+ * hexahedral geometries are wrapped by CV::CellArrayGeom instead. Filters then
+ * iterate the cells without a virtual call per cell. Geometries whose connectivity
+ * list is not held in a contiguous store fall back to the mapped wrappers.
+ *
  * Returns nullptr if the geometry is not recognized for wrapping.
  * @param geom
+ * @param mode
  * @return VTK_PTR(vtkDataSet)
  */
-COMPLEX2VTKLIB_EXPORT VTK_PTR(vtkDataSet) wrapGeometry(const std::shared_ptr<complex::AbstractGeometry>& geom);
+COMPLEX2VTKLIB_EXPORT VTK_PTR(vtkDataSet) wrapGeometry(const std::shared_ptr<complex::AbstractGeometry>& geom, GeometryWrapMode mode = GeometryWrapMode::Mapped);
+
+/**
+ * @brief Name of the per-cell feature id array used to map feature-level arrays onto cells.
+ */
+inline const std::string k_FeatureIdsArrayName = "FeatureIds";
 
 /**
  * @brief Attempts to create a vtkObject wrapping the specified complex geometry.
@@ -49,11 +78,20 @@ COMPLEX2VTKLIB_EXPORT VTK_PTR(vtkDataSet) wrapGeometry(const std::shared_ptr<com
  * it from being cleaned up if the DataStructure goes out of scope before the
  * vtkObject does.
  *
+ * If includeFeatureArrays is true and a single-component int32 "FeatureIds" array
+ * is linked as cell data, every other linked array whose tuples can be indexed by
+ * the feature ids is added as a CV::FeatureGatherArray cell array as well.
+ *
+ * The geometry itself is wrapped by wrapGeometry using the given mode.
+ *
  * Returns nullptr if the geometry is not recognized for wrapping.
  * @param geom
+ * @param includeFeatureArrays
+ * @param mode
  * @return VTK_PTR(vtkDataSet)
  */
-COMPLEX2VTKLIB_EXPORT VTK_PTR(vtkDataSet) wrapGeometryWithArrays(const std::shared_ptr<complex::AbstractGeometry>& geom);
+COMPLEX2VTKLIB_EXPORT VTK_PTR(vtkDataSet) wrapGeometryWithArrays(const std::shared_ptr<complex::AbstractGeometry>& geom, bool includeFeatureArrays = false,
+                                                                 GeometryWrapMode mode = GeometryWrapMode::Mapped);
 
 /**
  * @brief Attempts to wrap a complex DataArray found within the specified
@@ -70,5 +108,139 @@ COMPLEX2VTKLIB_EXPORT vtkDataArray* wrapDataArray(const complex::DataStructure&
  * @return vtkDataArray*
  */
 COMPLEX2VTKLIB_EXPORT vtkDataArray* wrapDataArray(const std::shared_ptr<complex::DataObject>& dataArray);
+
+/**
+ * @brief Attempts to present several single-component complex DataArrays of the same
+ * value type and tuple count as one multi-component CV::SOAArray without copying.
+ * Component k of the result is the DataArray with arrayIds[k]. The array is named by
+ * joining the DataArray names with '_'.
+ *
+ * With three float arrays, the result can be used directly as vtkPoints data, e.g.
+ * for vertex geometries whose coordinates are stored as separate X, Y, Z arrays.
+ *
+ * Returns nullptr if any DataArray is missing, has more than one component, or
+ * differs in value type or tuple count.
+ * @param dataStructure
+ * @param arrayIds
+ * @return vtkDataArray*
+ */
+COMPLEX2VTKLIB_EXPORT vtkDataArray* wrapDataArrays(const complex::DataStructure& dataStructure, const std::vector<complex::DataObject::IdType>& arrayIds);
+
+/**
+ * @brief Attempts to wrap a geometry's shared vertex list as vtkPoints without
+ * copying. The points' data is a CV::Array<float, 3> over the complex DataArray, which
+ * is looked up in the vertex list's DataStructure so that the points keep it alive.
+ *
+ * Returns nullptr if the DataObject is not a three-component float DataArray.
+ * @param vertexList
+ * @return VTK_PTR(vtkPoints)
+ */
+COMPLEX2VTKLIB_EXPORT VTK_PTR(vtkPoints) wrapVertexList(const complex::DataObject* vertexList);
+
+/**
+ * @brief Returns the std::shared_ptr to a cell connectivity list, e.g. a geometry's edge
+ * or tetrahedron list, by looking it up in the list's DataStructure.
+ *
+ * Returns nullptr if the DataObject is not a uint64 DataArray.
+ * @param connectivityList
+ * @return std::shared_ptr<complex::UInt64Array>
+ */
+COMPLEX2VTKLIB_EXPORT std::shared_ptr<complex::UInt64Array> findConnectivityList(const complex::DataObject* connectivityList);
+
+/**
+ * @brief Attempts to wrap a single component of a complex DataArray as a
+ * single-component CV::ComponentView without copying. The view is named
+ * "<ArrayName>_<component>".
+ *
+ * Returns nullptr if the DataObject is not a supported DataArray or the
+ * component is out of range.
+ * @param dataArray
+ * @param component
+ * @return vtkDataArray*
+ */
+COMPLEX2VTKLIB_EXPORT vtkDataArray* wrapDataArrayComponent(const std::shared_ptr<complex::DataObject>& dataArray, int component);
+
+/**
+ * @brief Adds a CV::ComponentView for every component of the complex DataArray to
+ * the given field data (e.g. cell or point data), named "<ArrayName>_0",
+ * "<ArrayName>_1", ... The views share the complex DataArray's memory.
+ * @param fieldData
+ * @param dataArray
+ * @return std::vector<std::string> Names of the added views
+ */
+COMPLEX2VTKLIB_EXPORT std::vector<std::string> addComponentViews(vtkFieldData* fieldData, const std::shared_ptr<complex::DataObject>& dataArray);
+
+/**
+ * @brief Attempts to wrap a complex NeighborList as a flat single-component
+ * CV::NeighborListArray. The values of list i are the values [offsets[i], offsets[i + 1])
+ * of the returned array. The values are read from the lists without copying; only the
+ * offsets are built in parallel and cached by the wrapper. If offsets is not null, it is set to the
+ * "<Name>_Offsets" array holding the number of lists + 1 offsets.
+ *
+ * Returns nullptr if the DataObject is not a supported NeighborList.
+ * @param neighborList
+ * @param offsets
+ * @return vtkDataArray*
+ */
+COMPLEX2VTKLIB_EXPORT vtkDataArray* wrapNeighborList(const std::shared_ptr<complex::DataObject>& neighborList, VTK_PTR(vtkIdTypeArray)* offsets = nullptr);
+
+/**
+ * @brief Wraps the complex NeighborList with wrapNeighborList and adds both the
+ * values and the "<Name>_Offsets" array to the given field data.
+ *
+ * Returns false if the DataObject is not a supported NeighborList.
+ * @param fieldData
+ * @param neighborList
+ * @return bool
+ */
+COMPLEX2VTKLIB_EXPORT bool addNeighborList(vtkFieldData* fieldData, const std::shared_ptr<complex::DataObject>& neighborList);
+
+/**
+ * @brief Attempts to present a per-feature complex DataArray as a per-cell
+ * CV::FeatureGatherArray without copying. Tuple i of the result is tuple
+ * featureIds[i] of the feature array.
+ *
+ * Returns nullptr if featureIds is not a single-component int32 DataArray, the
+ * feature array is not a supported DataArray, or a feature id is not a valid tuple
+ * index of the feature array. The feature ids are checked in parallel.
+ * @param featureIds
+ * @param featureArray
+ * @return vtkDataArray*
+ */
+COMPLEX2VTKLIB_EXPORT vtkDataArray* wrapFeatureArray(const std::shared_ptr<complex::DataObject>& featureIds, const std::shared_ptr<complex::DataObject>& featureArray);
+
+/**
+ * @brief Attempts to create a single-component CV::ComputedArray<double> holding the
+ * L2 norm of each tuple of the complex DataArray. The magnitudes are computed on
+ * demand in chunks and are never stored in the DataStructure. The array is named
+ * "<ArrayName>_Magnitude".
+ *
+ * Returns nullptr if the DataObject is not a supported DataArray.
+ * @param dataArray
+ * @return vtkDataArray*
+ */
+COMPLEX2VTKLIB_EXPORT vtkDataArray* wrapMagnitude(const std::shared_ptr<complex::DataObject>& dataArray);
+
+/**
+ * @brief Creates a complex DataArray named name in the DataStructure whose values are
+ * memory mapped copy-on-write from the raw binary file at filePath, and wraps it as a
+ * CV::Array<T>. Nothing is read up front: the OS loads pages when they are first
+ * accessed, so visualizing part of a large file only touches the pages it needs.
+ *
+ * This is the lazily loaded counterpart of complex::ImportFromBinaryFile. Throws
+ * std::runtime_error if the file cannot be mapped or is smaller than the given shape.
+ * Instantiated for the value types supported by wrapDataArray.
+ * @tparam T
+ * @param filePath
+ * @param name
+ * @param dataStructure
+ * @param tupleDims
+ * @param compDims
+ * @param parentId
+ * @return vtkDataArray*
+ */
+template <class T>
+COMPLEX2VTKLIB_EXPORT vtkDataArray* wrapRawFile(const std::filesystem::path& filePath, const std::string& name, complex::DataStructure& dataStructure, const std::vector<size_t>& tupleDims,
+                                                const std::vector<size_t>& compDims, const std::optional<complex::DataObject::IdType>& parentId = {});
 } // namespace VtkBridge
 } // namespace CV
@@ -0,0 +1,510 @@
+#include "complex2VtkLib/VtkBridge/CVArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVArrayPool.hpp"
+#include "complex2VtkLib/VtkBridge/CVRunLengthDataStore.hpp"
+#include "complex2VtkLib/VtkBridge/CVTetrahedralGeom.hpp"
+#include "complex2VtkLib/VtkBridge/VtkBridge.hpp"
+
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataGroup.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/DataStructure/Geometry/ImageGeom.hpp"
+#include "complex/DataStructure/Geometry/TetrahedralGeom.hpp"
+
+#include <vtkCellCenters.h>
+#include <vtkCellData.h>
+#include <vtkCellDataToPointData.h>
+#include <vtkDataSet.h>
+#include <vtkDataSetSurfaceFilter.h>
+#include <vtkCellIterator.h>
+#include <vtkFloatArray.h>
+#include <vtkIdList.h>
+#include <vtkIntArray.h>
+#include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkThreshold.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+
+using namespace complex;
+
+namespace
+{
+constexpr StringLiteral k_BenchmarkGroup = "Benchmark";
+constexpr StringLiteral k_BenchmarkGeom = "BenchmarkGeom";
+constexpr StringLiteral k_BenchmarkFeatureIds = "FeatureIds";
+constexpr StringLiteral k_BenchmarkVertices = "Vertices";
+constexpr StringLiteral k_BenchmarkTetrahedra = "Tetrahedra";
+
+/**
+ * @brief Runs the given function and returns the elapsed wall time in milliseconds.
+ * @param func
+ * @return double
+ */
+template <typename FuncT>
+double timeIt(FuncT&& func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  func();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void printTiming(const std::string& label, double milliseconds)
+{
+  std::cout << "  " << label << ": " << milliseconds << " ms" << std::endl;
+}
+
+/**
+ * @brief Creates an ImageGeom of dim^3 cells with a blocky FeatureIds cell array
+ * that resembles a segmented microstructure.
+ * @param dataStructure
+ * @param dim
+ * @return std::shared_ptr<ImageGeom>
+ */
+std::shared_ptr<ImageGeom> createLabelVolume(DataStructure& dataStructure, usize dim)
+{
+  DataGroup* group = DataGroup::Create(dataStructure, k_BenchmarkGroup);
+  ImageGeom* imageGeom = ImageGeom::Create(dataStructure, k_BenchmarkGeom, group->getId());
+  imageGeom->setSpacing({1.0f, 1.0f, 1.0f});
+  imageGeom->setOrigin({0.0f, 0.0f, 0.0f});
+  imageGeom->setDimensions({dim, dim, dim});
+
+  std::vector<usize> tupleDims = {dim, dim, dim};
+  Int32Array* featureIds = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, k_BenchmarkFeatureIds, tupleDims, {1}, group->getId());
+  const usize blockSize = 16;
+  const usize blocksPerDim = (dim + blockSize - 1) / blockSize;
+  for(usize z = 0; z < dim; z++)
+  {
+    for(usize y = 0; y < dim; y++)
+    {
+      for(usize x = 0; x < dim; x++)
+      {
+        const usize blockIndex = (z / blockSize) * blocksPerDim * blocksPerDim + (y / blockSize) * blocksPerDim + (x / blockSize);
+        (*featureIds)[(z * dim + y) * dim + x] = static_cast<int32>(blockIndex + 1);
+      }
+    }
+  }
+  imageGeom->getLinkedGeometryData().addCellData(DataPath({k_BenchmarkGroup, k_BenchmarkFeatureIds}));
+
+  return dataStructure.getSharedDataAs<ImageGeom>(imageGeom->getId());
+}
+
+/**
+ * @brief Creates a TetrahedralGeom that splits each of dim^3 unit cubes into the 6
+ * tetrahedra around its main diagonal.
+ * @param dataStructure
+ * @param dim
+ * @return std::shared_ptr<TetrahedralGeom>
+ */
+std::shared_ptr<TetrahedralGeom> createTetMesh(DataStructure& dataStructure, usize dim)
+{
+  const usize pointsPerDim = dim + 1;
+  const usize numPoints = pointsPerDim * pointsPerDim * pointsPerDim;
+  Float32Array* vertices = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, k_BenchmarkVertices, {numPoints}, {3});
+  for(usize z = 0; z < pointsPerDim; z++)
+  {
+    for(usize y = 0; y < pointsPerDim; y++)
+    {
+      for(usize x = 0; x < pointsPerDim; x++)
+      {
+        const usize pointId = (z * pointsPerDim + y) * pointsPerDim + x;
+        (*vertices)[pointId * 3] = static_cast<float32>(x);
+        (*vertices)[pointId * 3 + 1] = static_cast<float32>(y);
+        (*vertices)[pointId * 3 + 2] = static_cast<float32>(z);
+      }
+    }
+  }
+
+  // Corner c of a cube is offset by (c & 1, (c >> 1) & 1, c >> 2). Every tetrahedron
+  // walks from corner 0 to corner 7 along one permutation of the axes.
+  const std::array<std::array<usize, 4>, 6> tetCorners = {{{0, 1, 3, 7}, {0, 1, 5, 7}, {0, 2, 3, 7}, {0, 2, 6, 7}, {0, 4, 5, 7}, {0, 4, 6, 7}}};
+  const usize numTets = dim * dim * dim * tetCorners.size();
+  UInt64Array* tetrahedra = UInt64Array::CreateWithStore<UInt64DataStore>(dataStructure, k_BenchmarkTetrahedra, {numTets}, {4});
+  usize valueIdx = 0;
+  for(usize z = 0; z < dim; z++)
+  {
+    for(usize y = 0; y < dim; y++)
+    {
+      for(usize x = 0; x < dim; x++)
+      {
+        for(const auto& corners : tetCorners)
+        {
+          for(usize corner : corners)
+          {
+            (*tetrahedra)[valueIdx++] = ((z + (corner >> 2)) * pointsPerDim + y + ((corner >> 1) & 1)) * pointsPerDim + x + (corner & 1);
+          }
+        }
+      }
+    }
+  }
+
+  TetrahedralGeom* tetGeom = TetrahedralGeom::Create(dataStructure, k_BenchmarkGeom);
+  tetGeom->setVertices(*vertices);
+  tetGeom->setTetrahedra(*tetrahedra);
+  return dataStructure.getSharedDataAs<TetrahedralGeom>(tetGeom->getId());
+}
+
+/**
+ * @brief Visits every cell of the dataset with its vtkCellIterator, reading the cell
+ * type, point ids and points, and returns the elapsed time.
+ * @param dataSet
+ * @param checksum
+ * @return double
+ */
+double iterateCells(vtkDataSet* dataSet, double& checksum)
+{
+  return timeIt([&]() {
+    vtkSmartPointer<vtkCellIterator> cellIter;
+    cellIter.TakeReference(dataSet->NewCellIterator());
+    for(cellIter->InitTraversal(); !cellIter->IsDoneWithTraversal(); cellIter->GoToNextCell())
+    {
+      checksum += cellIter->GetCellType() + cellIter->GetPointIds()->GetId(0) + cellIter->GetPoints()->GetPoint(0)[0];
+    }
+  });
+}
+
+/**
+ * @brief Runs vtkThreshold over the FeatureIds cell array and returns the elapsed time.
+ * @param dataSet
+ * @param arrayName
+ * @param numCellsOut
+ * @return double
+ */
+double runThreshold(vtkDataSet* dataSet, const std::string& arrayName, vtkIdType& numCellsOut)
+{
+  vtkNew<vtkThreshold> threshold;
+  threshold->SetInputData(dataSet);
+  threshold->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, arrayName.c_str());
+  threshold->SetLowerThreshold(1.0);
+  threshold->SetUpperThreshold(100.0);
+  const double elapsed = timeIt([&threshold]() { threshold->Update(); });
+  numCellsOut = threshold->GetOutput()->GetNumberOfCells();
+  return elapsed;
+}
+
+/**
+ * @brief Compares element access and vtkThreshold throughput over a wrapped
+ * CV::Array against a native vtkIntArray holding the same values.
+ * @param dim
+ */
+void benchmarkElementAccess(usize dim)
+{
+  std::cout << "Element access (" << dim << "^3 cells)" << std::endl;
+
+  DataStructure dataStructure;
+  auto imageGeom = createLabelVolume(dataStructure, dim);
+  auto featureIds = dataStructure.getSharedDataAs<Int32Array>(DataPath({k_BenchmarkGroup, k_BenchmarkFeatureIds}));
+
+  VTK_PTR(vtkDataSet) wrappedGeom = CV::VtkBridge::wrapGeometry(imageGeom);
+  vtkSmartPointer<vtkDataArray> wrappedArray;
+  wrappedArray.TakeReference(CV::VtkBridge::wrapDataArray(featureIds));
+  wrappedGeom->GetCellData()->AddArray(wrappedArray);
+
+  auto* cvArray = CV::Array<int32, 1>::SafeDownCast(wrappedArray);
+  std::cout << "  Contiguous fast path: " << (cvArray != nullptr && cvArray->HasContiguousStorage() ? "yes" : "no") << std::endl;
+
+  vtkNew<vtkIntArray> nativeArray;
+  nativeArray->SetName("NativeFeatureIds");
+  nativeArray->DeepCopy(wrappedArray);
+  VTK_PTR(vtkDataSet) nativeGeom = CV::VtkBridge::wrapGeometry(imageGeom);
+  nativeGeom->GetCellData()->AddArray(nativeArray);
+
+  int64 sum = 0;
+  printTiming("CV::Array GetTypedComponent sweep", timeIt([&]() {
+                const vtkIdType numTuples = cvArray->GetNumberOfTuples();
+                for(vtkIdType i = 0; i < numTuples; i++)
+                {
+                  sum += cvArray->GetTypedComponent(i, 0);
+                }
+              }));
+  printTiming("vtkIntArray GetTypedComponent sweep", timeIt([&]() {
+                const vtkIdType numTuples = nativeArray->GetNumberOfTuples();
+                for(vtkIdType i = 0; i < numTuples; i++)
+                {
+                  sum += nativeArray->GetTypedComponent(i, 0);
+                }
+              }));
+
+  vtkIdType wrappedCells = 0;
+  vtkIdType nativeCells = 0;
+  printTiming("vtkThreshold over CV::Array", runThreshold(wrappedGeom, featureIds->getName(), wrappedCells));
+  printTiming("vtkThreshold over vtkIntArray", runThreshold(nativeGeom, nativeArray->GetName(), nativeCells));
+  std::cout << "  Output cells: " << wrappedCells << " / " << nativeCells << " (checksum " << sum << ")" << std::endl;
+}
+
+/**
+ * @brief Compresses the FeatureIds array with CV::RunLengthDataStore and compares
+ * its memory use and element access and vtkThreshold throughput with the flat array.
+ * @param dim
+ */
+void benchmarkRunLength(usize dim)
+{
+  std::cout << "Run-length encoded FeatureIds (" << dim << "^3 cells)" << std::endl;
+
+  DataStructure dataStructure;
+  auto imageGeom = createLabelVolume(dataStructure, dim);
+  auto featureIds = dataStructure.getSharedDataAs<Int32Array>(DataPath({k_BenchmarkGroup, k_BenchmarkFeatureIds}));
+
+  const usize flatSize = featureIds->getSize() * sizeof(int32);
+  usize encodedSize = 0;
+  printTiming("Compress", timeIt([&]() { encodedSize = CV::CompressDataArray(*featureIds); }));
+  std::cout << "  Flat: " << flatSize << " bytes, encoded: " << encodedSize << " bytes (" << static_cast<double>(flatSize) / static_cast<double>(encodedSize) << "x)" << std::endl;
+
+  VTK_PTR(vtkDataSet) wrappedGeom = CV::VtkBridge::wrapGeometry(imageGeom);
+  vtkSmartPointer<vtkDataArray> wrappedArray;
+  wrappedArray.TakeReference(CV::VtkBridge::wrapDataArray(featureIds));
+  wrappedGeom->GetCellData()->AddArray(wrappedArray);
+  auto* cvArray = CV::Array<int32, 1>::SafeDownCast(wrappedArray);
+
+  int64 sum = 0;
+  printTiming("CV::Array GetTypedComponent sweep", timeIt([&]() {
+                const vtkIdType numTuples = cvArray->GetNumberOfTuples();
+                for(vtkIdType i = 0; i < numTuples; i++)
+                {
+                  sum += cvArray->GetTypedComponent(i, 0);
+                }
+              }));
+
+  vtkIdType numCells = 0;
+  printTiming("vtkThreshold over CV::Array", runThreshold(wrappedGeom, featureIds->getName(), numCells));
+  std::cout << "  Output cells: " << numCells << " (checksum " << sum << ")" << std::endl;
+
+  CV::StagingCounters::Reset();
+  printTiming("GetVoidPointer staging", timeIt([&]() { cvArray->GetVoidPointer(0); }));
+  printTiming("DataChanged write-back", timeIt([&]() { cvArray->DataChanged(); }));
+  cvArray->ReleaseStagedValues();
+  std::cout << "  Staged " << CV::StagingCounters::Materializations << " time(s), " << CV::StagingCounters::MaterializedBytes << " bytes; wrote back " << CV::StagingCounters::WriteBacks
+            << " time(s), " << CV::StagingCounters::WrittenBackBytes << " bytes" << std::endl;
+}
+
+/**
+ * @brief Times the first and the repeated GetRange call on a wrapped array, which
+ * is what happens when the active scalars are switched in a viewer.
+ * @param dim
+ */
+void benchmarkRange(usize dim)
+{
+  std::cout << "Scalar range (" << dim << "^3 cells)" << std::endl;
+
+  DataStructure dataStructure;
+  createLabelVolume(dataStructure, dim);
+  auto featureIds = dataStructure.getSharedDataAs<Int32Array>(DataPath({k_BenchmarkGroup, k_BenchmarkFeatureIds}));
+
+  vtkSmartPointer<vtkDataArray> wrappedArray;
+  wrappedArray.TakeReference(CV::VtkBridge::wrapDataArray(featureIds));
+
+  std::array<double, 2> range = {0.0, 0.0};
+  printTiming("First GetRange", timeIt([&]() { wrappedArray->GetRange(range.data()); }));
+  printTiming("Cached GetRange", timeIt([&]() { wrappedArray->GetRange(range.data()); }));
+  wrappedArray->Modified();
+  printTiming("GetRange after Modified()", timeIt([&]() { wrappedArray->GetRange(range.data()); }));
+  std::cout << "  Range: [" << range[0] << ", " << range[1] << "]" << std::endl;
+}
+
+/**
+ * @brief Runs vtkThreshold, vtkDataSetSurfaceFilter and vtkCellDataToPointData over a
+ * wrapped geometry under each CV::NewInstancePolicy and reports the time and the
+ * arrays the filters created through CV::Array::NewInstance(). The default
+ * ComplexArray policy runs first and the opt-in VtkArray policy last. The pipeline
+ * runs twice per policy so that the second run shows buffer reuse by CV::ArrayPool.
+ * @param dim
+ */
+void benchmarkPipeline(usize dim)
+{
+  std::cout << "Filter pipeline (" << dim << "^3 cells)" << std::endl;
+
+  DataStructure dataStructure;
+  auto imageGeom = createLabelVolume(dataStructure, dim);
+  auto featureIds = dataStructure.getSharedDataAs<Int32Array>(DataPath({k_BenchmarkGroup, k_BenchmarkFeatureIds}));
+
+  VTK_PTR(vtkDataSet) wrappedGeom = CV::VtkBridge::wrapGeometry(imageGeom);
+  vtkSmartPointer<vtkDataArray> wrappedArray;
+  wrappedArray.TakeReference(CV::VtkBridge::wrapDataArray(featureIds));
+  wrappedGeom->GetCellData()->AddArray(wrappedArray);
+
+  const std::array<std::pair<CV::NewInstancePolicy, std::string>, 3> policies = {{{CV::NewInstancePolicy::ComplexArray, "ComplexArray (default)"},
+                                                                                  {CV::NewInstancePolicy::PooledComplexArray, "PooledComplexArray"},
+                                                                                  {CV::NewInstancePolicy::VtkArray, "VtkArray"}}};
+  const CV::NewInstancePolicy oldPolicy = CV::ArrayPool::GetNewInstancePolicy();
+  for(const auto& [policy, policyName] : policies)
+  {
+    CV::ArrayPool::SetNewInstancePolicy(policy);
+    for(int run = 1; run <= 2; run++)
+    {
+      CV::ArrayPool::ResetStatistics();
+      vtkIdType numPoints = 0;
+      const double elapsed = timeIt([&]() {
+        vtkNew<vtkThreshold> threshold;
+        threshold->SetInputData(wrappedGeom);
+        threshold->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, featureIds->getName().c_str());
+        threshold->SetLowerThreshold(1.0);
+        threshold->SetUpperThreshold(100.0);
+        vtkNew<vtkDataSetSurfaceFilter> surface;
+        surface->SetInputConnection(threshold->GetOutputPort());
+        vtkNew<vtkCellDataToPointData> cellToPoint;
+        cellToPoint->SetInputConnection(surface->GetOutputPort());
+        cellToPoint->Update();
+        numPoints = cellToPoint->GetOutput()->GetNumberOfPoints();
+      });
+      const CV::ArrayPool::Statistics statistics = CV::ArrayPool::GetStatistics();
+      printTiming(policyName + " run " + std::to_string(run), elapsed);
+      std::cout << "    VTK arrays: " << statistics.vtkArrays << ", complex arrays: " << statistics.complexArrays << ", pool allocations: " << statistics.allocations
+                << ", pool reuses: " << statistics.reuses << " (output points " << numPoints << ")" << std::endl;
+    }
+  }
+  CV::ArrayPool::SetNewInstancePolicy(oldPolicy);
+  CV::ArrayPool::Trim();
+}
+
+/**
+ * @brief Iterates the cells of a wrapped tetrahedral mesh of 6 * dim^3 cells and runs
+ * vtkCellCenters over it. CV::MappedCellIterator is compared with the per-cell
+ * GetCellType(), GetCellPoints() and vtkPoints::GetPoints() calls that VTK's default
+ * vtkMappedUnstructuredGridCellIterator makes, and with the same mesh wrapped as a
+ * vtkUnstructuredGrid over a vtkCellArray. Returns false if the three traversals
+ * disagree.
+ * @param dim
+ * @return bool
+ */
+bool benchmarkCellIteration(usize dim)
+{
+  std::cout << "Cell iteration (" << 6 * dim * dim * dim << " tetrahedra)" << std::endl;
+
+  DataStructure dataStructure;
+  auto tetGeom = createTetMesh(dataStructure, dim);
+  VTK_PTR(vtkDataSet) mappedGrid = CV::VtkBridge::wrapGeometry(tetGeom, CV::VtkBridge::GeometryWrapMode::Mapped);
+  VTK_PTR(vtkDataSet) cellArrayGrid = CV::VtkBridge::wrapGeometry(tetGeom, CV::VtkBridge::GeometryWrapMode::CellArray);
+  auto* tetGrid = CV::CVTetrahedralGrid::SafeDownCast(mappedGrid);
+  if(nullptr == tetGrid || nullptr == cellArrayGrid)
+  {
+    std::cout << "  Could not wrap the tetrahedral mesh" << std::endl;
+    return false;
+  }
+
+  double mappedChecksum = 0.0;
+  double perCellChecksum = 0.0;
+  double cellArrayChecksum = 0.0;
+  printTiming("CV::MappedCellIterator", iterateCells(mappedGrid, mappedChecksum));
+  printTiming("Per-cell implementation calls", timeIt([&]() {
+                CV::TetrahedralGeom* impl = tetGrid->GetImplementation();
+                vtkPoints* gridPoints = tetGrid->GetPoints();
+                vtkNew<vtkIdList> pointIds;
+                vtkNew<vtkPoints> cellPoints;
+                const vtkIdType numCells = impl->GetNumberOfCells();
+                for(vtkIdType cellId = 0; cellId < numCells; cellId++)
+                {
+                  const int cellType = impl->GetCellType(cellId);
+                  impl->GetCellPoints(cellId, pointIds);
+                  gridPoints->GetPoints(pointIds, cellPoints);
+                  perCellChecksum += cellType + pointIds->GetId(0) + cellPoints->GetPoint(0)[0];
+                }
+              }));
+  printTiming("vtkCellArray iterator", iterateCells(cellArrayGrid, cellArrayChecksum));
+
+  vtkIdType numCenters = 0;
+  for(const auto& [dataSet, label] : {std::make_pair(mappedGrid.Get(), std::string("vtkCellCenters over the mapped grid")),
+                                      std::make_pair(cellArrayGrid.Get(), std::string("vtkCellCenters over the vtkCellArray grid"))})
+  {
+    vtkNew<vtkCellCenters> cellCenters;
+    cellCenters->SetInputData(dataSet);
+    printTiming(label, timeIt([&cellCenters]() { cellCenters->Update(); }));
+    numCenters = cellCenters->GetOutput()->GetNumberOfPoints();
+  }
+  std::cout << "  Cell centers: " << numCenters << " (checksum " << mappedChecksum << ")" << std::endl;
+  if(mappedChecksum != perCellChecksum || mappedChecksum != cellArrayChecksum)
+  {
+    std::cout << "  The traversals disagree: " << mappedChecksum << ", " << perCellChecksum << ", " << cellArrayChecksum << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Appends numTuples single-component tuples one at a time into a wrapped
+ * array that starts out empty, and into a vtkFloatArray for reference. Returns false
+ * if the wrapped array lost or changed any appended value.
+ * @param numTuples
+ * @return bool
+ */
+bool benchmarkAppend(vtkIdType numTuples)
+{
+  std::cout << "Append (" << numTuples << " tuples)" << std::endl;
+
+  DataStructure dataStructure;
+  Float32Array* complexArray = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Appended", {0}, {1});
+  auto sharedArray = dataStructure.getSharedDataAs<Float32Array>(complexArray->getId());
+
+  vtkSmartPointer<vtkDataArray> wrappedArray;
+  wrappedArray.TakeReference(CV::VtkBridge::wrapDataArray(sharedArray));
+  auto* cvArray = CV::Array<float, 1>::SafeDownCast(wrappedArray);
+
+  printTiming("CV::Array InsertNextValue", timeIt([&]() {
+                for(vtkIdType i = 0; i < numTuples; i++)
+                {
+                  cvArray->InsertNextValue(static_cast<float>(i));
+                }
+              }));
+
+  vtkNew<vtkFloatArray> nativeArray;
+  printTiming("vtkFloatArray InsertNextValue", timeIt([&]() {
+                for(vtkIdType i = 0; i < numTuples; i++)
+                {
+                  nativeArray->InsertNextValue(static_cast<float>(i));
+                }
+              }));
+  std::cout << "  Tuples: " << cvArray->GetNumberOfTuples() << " / " << nativeArray->GetNumberOfTuples() << std::endl;
+
+  cvArray->Squeeze();
+  if(cvArray->GetNumberOfTuples() != numTuples || sharedArray->getNumberOfTuples() != static_cast<usize>(numTuples))
+  {
+    std::cout << "  Wrong number of appended tuples" << std::endl;
+    return false;
+  }
+  for(vtkIdType i = 0; i < numTuples; i++)
+  {
+    if(cvArray->GetValue(i) != nativeArray->GetValue(i))
+    {
+      std::cout << "  Appended value " << i << " was lost" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  usize dim = 256;
+  if(argc > 1)
+  {
+    dim = std::stoul(argv[1]);
+  }
+  vtkIdType numAppendTuples = 100000000;
+  if(argc > 2)
+  {
+    numAppendTuples = std::stoll(argv[2]);
+  }
+  usize meshDim = 64;
+  if(argc > 3)
+  {
+    meshDim = std::stoul(argv[3]);
+  }
+
+  benchmarkElementAccess(dim);
+  benchmarkRunLength(dim);
+  benchmarkRange(dim);
+  benchmarkPipeline(dim);
+  bool valid = benchmarkAppend(numAppendTuples);
+  valid = benchmarkCellIteration(meshDim) && valid;
+
+  return valid ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,6 +1,7 @@
 
 
 #include "complex2VtkLib/VtkBridge/CVArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVCellArrayGeom.hpp"
 
 #include "Utilities.hpp"
 
@@ -187,14 +188,7 @@ public:
 
     // ******************* This section wraps the existing connectivity list into a vtkPolyObject
     std::shared_ptr<complex::UInt64Array> complexFaceConnectivity = m_DataStructure->getSharedDataAs<complex::UInt64Array>(complexNodeGeometry2D->getTriangleArrayId());
-    complex::UInt64DataStore* dataStore = complexFaceConnectivity->template getIDataStoreAs<DataStore<uint64_t>>();
-
-    // This is ugly but about the only way to reuse the existing connectivity array
-    vtkNew<vtkLongLongArray> faceConnectivity;
-    faceConnectivity->SetArray(reinterpret_cast<long long*>(dataStore->data()), complexFaceConnectivity->getSize(), 1);
-
-    vtkNew<vtkCellArray> complexCellArray;
-    complexCellArray->SetData(AbstractGeometry2DType::k_NumVerts, faceConnectivity);
+    VTK_PTR(vtkCellArray) complexCellArray = CV::CellArrayGeom::CreateCellArray(complexFaceConnectivity, AbstractGeometry2DType::k_NumVerts);
     polyData->SetPolys(complexCellArray);
 
     complex::LinkedGeometryData& linkedGeometryData = complexNodeGeometry2D->getLinkedGeometryData();
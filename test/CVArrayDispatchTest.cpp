@@ -0,0 +1,106 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVArrayDispatch.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+
+#include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
+#include <vtkNew.h>
+#include <vtkSmartPointer.h>
+
+#include <atomic>
+#include <type_traits>
+
+#include "TestUtilities.hpp"
+
+using namespace complex;
+
+namespace
+{
+/**
+ * @brief Adds the components of every tuple of the dispatched array.
+ */
+struct SumWorker
+{
+  template <class ArrayT>
+  void operator()(ArrayT* array, double& sum, bool& isCVArray) const
+  {
+    isCVArray = std::is_same<ArrayT, CV::Array<float, 3>>::value;
+    for(vtkIdType tupleIdx = 0; tupleIdx < array->GetNumberOfTuples(); tupleIdx++)
+    {
+      for(int compIdx = 0; compIdx < array->GetNumberOfComponents(); compIdx++)
+      {
+        sum += static_cast<double>(array->GetTypedComponent(tupleIdx, compIdx));
+      }
+    }
+  }
+};
+
+/**
+ * @brief Copies the values of the first dispatched array into the second one.
+ */
+struct CopyWorker
+{
+  template <class SourceT, class DestinationT>
+  void operator()(SourceT* source, DestinationT* destination) const
+  {
+    for(vtkIdType valueIdx = 0; valueIdx < source->GetNumberOfValues(); valueIdx++)
+    {
+      destination->SetValue(valueIdx, source->GetValue(valueIdx));
+    }
+  }
+};
+} // namespace
+
+TEST_CASE("CV::Dispatch: wrapped arrays are dispatched to their CV::Array type", "[complex2VtkLib][ArrayDispatch]")
+{
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<float>(dataStructure, "Vectors", CVTest::Sequence<float>(12), 3);
+  vtkSmartPointer<CV::Array<float, 3>> array;
+  array.TakeReference(new CV::Array<float, 3>(dataArray));
+
+  double sum = 0.0;
+  bool isCVArray = false;
+  REQUIRE(CV::Dispatch::Execute(array, SumWorker(), sum, isCVArray));
+  REQUIRE(isCVArray);
+  REQUIRE(sum == 66.0);
+
+  std::atomic<int> numTuples{0};
+  REQUIRE(CV::Dispatch::ParallelForTuples(array, [&numTuples](auto* typedArray, vtkIdType begin, vtkIdType end) { numTuples += static_cast<int>(end - begin); }));
+  REQUIRE(numTuples == 4);
+
+  vtkIdType lastTuple = -1;
+  REQUIRE(CV::Dispatch::ForEachTuple(array, [&lastTuple](auto* typedArray, vtkIdType tupleIdx) {
+    REQUIRE(tupleIdx == lastTuple + 1);
+    lastTuple = tupleIdx;
+  }));
+  REQUIRE(lastTuple == 3);
+}
+
+#ifdef C2V_DISPATCH_VTK_ARRAYS
+TEST_CASE("CV::Dispatch: native VTK arrays are dispatched next to wrapped arrays", "[complex2VtkLib][ArrayDispatch]")
+{
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<float>(dataStructure, "Vectors", CVTest::Sequence<float>(12), 3);
+  vtkSmartPointer<CV::Array<float, 3>> array;
+  array.TakeReference(new CV::Array<float, 3>(dataArray));
+
+  vtkNew<vtkFloatArray> nativeArray;
+  nativeArray->SetNumberOfComponents(3);
+  nativeArray->SetNumberOfTuples(4);
+
+  double sum = 0.0;
+  bool isCVArray = true;
+  REQUIRE(CV::Dispatch::Execute(nativeArray, SumWorker(), sum, isCVArray));
+  REQUIRE_FALSE(isCVArray);
+
+  REQUIRE(CV::Dispatch::Execute2SameValueType(array, nativeArray, CopyWorker()));
+  REQUIRE(nativeArray->GetValue(11) == 11.0f);
+
+  // The value types must match.
+  vtkNew<vtkDoubleArray> doubleArray;
+  doubleArray->SetNumberOfValues(12);
+  REQUIRE_FALSE(CV::Dispatch::Execute2SameValueType(array, doubleArray, CopyWorker()));
+}
+#endif
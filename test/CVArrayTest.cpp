@@ -0,0 +1,289 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVArrayPool.hpp"
+#include "complex2VtkLib/VtkBridge/CVRunLengthDataStore.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+
+#include <vtkIntArray.h>
+#include <vtkNew.h>
+#include <vtkSmartPointer.h>
+
+#include "TestUtilities.hpp"
+
+#include <cmath>
+#include <limits>
+
+using namespace complex;
+
+TEST_CASE("CV::Array: contiguous stores are accessed through the raw pointer", "[complex2VtkLib][Array]")
+{
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<float>(dataStructure, "Values", CVTest::Sequence<float>(12), 3);
+
+  vtkSmartPointer<CV::Array<float, 3>> array;
+  array.TakeReference(new CV::Array<float, 3>(dataArray));
+
+  REQUIRE(array->HasContiguousStorage());
+  REQUIRE(array->HasStandardMemoryLayout());
+  REQUIRE(array->GetNumberOfTuples() == 4);
+  REQUIRE(array->GetNumberOfComponents() == 3);
+  REQUIRE(array->GetVoidPointer(0) == CV::GetContiguousData(dataArray->getDataStore()));
+
+  for(vtkIdType valueIdx = 0; valueIdx < 12; valueIdx++)
+  {
+    REQUIRE(array->GetValue(valueIdx) == static_cast<float>(valueIdx));
+  }
+  float tuple[3] = {};
+  array->GetTypedTuple(2, tuple);
+  REQUIRE(tuple[0] == 6.0f);
+  REQUIRE(tuple[2] == 8.0f);
+
+  array->SetTypedComponent(1, 2, 42.0f);
+  array->SetValue(0, -1.0f);
+  REQUIRE((*dataArray)[5] == 42.0f);
+  REQUIRE((*dataArray)[0] == -1.0f);
+}
+
+TEST_CASE("CV::Array: SetComplexArray() caches the pointer of the new store", "[complex2VtkLib][Array]")
+{
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<int32>(dataStructure, "Values", CVTest::Sequence<int32>(8));
+
+  vtkSmartPointer<CV::Array<int32, 1>> array;
+  array.TakeReference(new CV::Array<int32, 1>(dataArray));
+  REQUIRE(array->GetValue(7) == 7);
+
+  auto replacement = std::make_shared<DataStore<int32>>(std::vector<usize>{8}, std::vector<usize>{1});
+  for(usize idx = 0; idx < 8; idx++)
+  {
+    replacement->setValue(idx, 100 + static_cast<int32>(idx));
+  }
+  dataArray->setDataStore(replacement);
+  array->SetComplexArray(dataArray);
+
+  REQUIRE(array->HasContiguousStorage());
+  REQUIRE(array->GetVoidPointer(0) == replacement->data());
+  REQUIRE(array->GetValue(7) == 107);
+}
+
+TEST_CASE("CV::Array: non-contiguous stores are read through the store", "[complex2VtkLib][Array]")
+{
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<int32>(dataStructure, "Labels", std::vector<int32>(10000, 3));
+  (*dataArray)[9999] = 5;
+  CV::CompressDataArray(*dataArray);
+
+  vtkSmartPointer<CV::Array<int32, 1>> array;
+  array.TakeReference(new CV::Array<int32, 1>(dataArray));
+  array->SetStagingEnabled(false);
+
+  REQUIRE_FALSE(array->HasContiguousStorage());
+  REQUIRE(array->GetVoidPointer(0) == nullptr);
+  REQUIRE(array->GetValue(0) == 3);
+  REQUIRE(array->GetTypedComponent(9999, 0) == 5);
+
+  array->SetValue(4096, 7);
+  REQUIRE(dataArray->getDataStore()->getValue(4096) == 7);
+  REQUIRE(array->GetValue(4095) == 3);
+}
+
+TEST_CASE("CV::Array: NewInstance() of a fixed component array has dynamic components", "[complex2VtkLib][Array]")
+{
+  const CV::NewInstancePolicy previousPolicy = CV::ArrayPool::GetNewInstancePolicy();
+  CV::ArrayPool::SetNewInstancePolicy(CV::NewInstancePolicy::ComplexArray);
+
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<float>(dataStructure, "Vectors", CVTest::Sequence<float>(9), 3);
+  vtkSmartPointer<CV::Array<float, 3>> array;
+  array.TakeReference(new CV::Array<float, 3>(dataArray));
+
+  vtkSmartPointer<vtkDataArray> instance;
+  instance.TakeReference(array->NewInstance());
+  REQUIRE(instance != nullptr);
+  auto* dynamicArray = CV::Array<float>::SafeDownCast(instance);
+  REQUIRE(dynamicArray != nullptr);
+  REQUIRE(CV::Array<float, 3>::SafeDownCast(instance) == nullptr);
+
+  dynamicArray->SetNumberOfComponents(2);
+  dynamicArray->SetNumberOfTuples(5);
+  REQUIRE(dynamicArray->GetNumberOfComponents() == 2);
+  REQUIRE(dynamicArray->GetNumberOfTuples() == 5);
+
+  CV::ArrayPool::SetNewInstancePolicy(previousPolicy);
+}
+
+TEST_CASE("CV::Array: growing keeps the complex tuple count logical", "[complex2VtkLib][Array]")
+{
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<int32>(dataStructure, "Values", CVTest::Sequence<int32>(4));
+
+  vtkSmartPointer<CV::Array<int32, 1>> array;
+  array.TakeReference(new CV::Array<int32, 1>(dataArray));
+
+  for(int32 value = 4; value < 1000; value++)
+  {
+    array->InsertNextValue(value);
+  }
+  REQUIRE(array->GetNumberOfTuples() == 1000);
+  REQUIRE(array->GetSize() >= 1000);
+  // Values appended between growths survive every reallocation, not only the tuples
+  // complex knew about at the time.
+  for(vtkIdType valueIdx = 0; valueIdx < 1000; valueIdx++)
+  {
+    REQUIRE(array->GetValue(valueIdx) == static_cast<int32>(valueIdx));
+  }
+
+  array->Squeeze();
+  REQUIRE(array->GetSize() == 1000);
+  REQUIRE(array->GetComplexArray()->getNumberOfTuples() == 1000);
+  for(vtkIdType valueIdx = 0; valueIdx < 1000; valueIdx++)
+  {
+    REQUIRE(array->GetValue(valueIdx) == static_cast<int32>(valueIdx));
+  }
+
+  array->SetNumberOfTuples(10);
+  REQUIRE(array->GetComplexArray()->getNumberOfTuples() == 10);
+  REQUIRE(array->GetValue(9) == 9);
+}
+
+TEST_CASE("CV::Array: staged stores write back only the written tuples", "[complex2VtkLib][Array]")
+{
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<int32>(dataStructure, "Labels", std::vector<int32>(10000, 3));
+  CV::CompressDataArray(*dataArray);
+  auto* dataStore = dataArray->getDataStore();
+
+  vtkSmartPointer<CV::Array<int32, 1>> array;
+  array.TakeReference(new CV::Array<int32, 1>(dataArray));
+  auto* values = static_cast<int32*>(array->GetVoidPointer(0));
+  REQUIRE(values != nullptr);
+  REQUIRE(array->IsStaged());
+  REQUIRE(array->GetNumberOfMaterializations() == 1);
+
+  // Writes through the API are tracked per block, so only that block is written back
+  // and complex writes to other blocks survive. GetVoidPointer() was called, so the
+  // written tuples are reported explicitly.
+  CV::StagingCounters::Reset();
+  array->SetValue(5, 7);
+  dataStore->setValue(9000, 11);
+  REQUIRE(array->GetNumberOfStagedDirtyTuples() > 0);
+  REQUIRE(array->GetNumberOfStagedDirtyTuples() < 10000);
+  array->MarkTuplesDirty(5, 6);
+  array->DataChanged();
+  REQUIRE(dataStore->getValue(5) == 7);
+  REQUIRE(dataStore->getValue(9000) == 11);
+  REQUIRE(array->GetNumberOfStagedDirtyTuples() == 0);
+  REQUIRE(CV::StagingCounters::WrittenBackBytes < 10000 * sizeof(int32));
+
+  // Unreported writes through the pointer are found by comparing with the store.
+  values = static_cast<int32*>(array->GetVoidPointer(0));
+  values[8000] = 13;
+  array->DataChanged();
+  REQUIRE(dataStore->getValue(8000) == 13);
+  REQUIRE(dataStore->getValue(5) == 7);
+
+  // Nothing written, nothing written back.
+  const uint64_t numWriteBacks = array->GetNumberOfWriteBacks();
+  array->DataChanged();
+  REQUIRE(array->GetNumberOfWriteBacks() == numWriteBacks);
+
+  array->ReleaseStagedValues();
+  REQUIRE_FALSE(array->IsStaged());
+  REQUIRE(array->GetValue(8000) == 13);
+}
+
+TEST_CASE("CV::Array: NewInstance() returns complex backed arrays by default", "[complex2VtkLib][Array]")
+{
+  REQUIRE(CV::ArrayPool::GetNewInstancePolicy() == CV::NewInstancePolicy::ComplexArray);
+
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<int32>(dataStructure, "Values", CVTest::Sequence<int32>(4));
+  vtkSmartPointer<CV::Array<int32, 1>> array;
+  array.TakeReference(new CV::Array<int32, 1>(dataArray));
+
+  vtkSmartPointer<vtkDataArray> instance;
+  instance.TakeReference(array->NewInstance());
+  auto* complexInstance = CV::Array<int32>::SafeDownCast(instance);
+  REQUIRE(complexInstance != nullptr);
+  REQUIRE(complexInstance->GetComplexArray() != nullptr);
+
+  CV::ArrayPool::SetNewInstancePolicy(CV::NewInstancePolicy::VtkArray);
+  instance.TakeReference(array->NewInstance());
+  REQUIRE(CV::Array<int32>::SafeDownCast(instance) == nullptr);
+  REQUIRE(instance->GetDataType() == VTK_INT);
+  CV::ArrayPool::SetNewInstancePolicy(CV::NewInstancePolicy::ComplexArray);
+}
+
+TEST_CASE("CV::Array: staged arrays read and keep their buffered values", "[complex2VtkLib][Array]")
+{
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<int32>(dataStructure, "Labels", std::vector<int32>(10000, 3));
+  CV::CompressDataArray(*dataArray);
+  auto* dataStore = dataArray->getDataStore();
+
+  vtkSmartPointer<CV::Array<int32, 1>> array;
+  array.TakeReference(new CV::Array<int32, 1>(dataArray));
+  auto* values = static_cast<int32*>(array->GetVoidPointer(0));
+  REQUIRE(array->IsStaged());
+
+  // Range copies see values that are only in the staging buffer.
+  values[2] = 8;
+  vtkNew<vtkIntArray> output;
+  output->SetNumberOfTuples(4);
+  array->GetTuples(0, 3, output);
+  REQUIRE(output->GetValue(2) == 8);
+  array->DataChanged();
+  REQUIRE(dataStore->getValue(2) == 8);
+
+  // A deep copy into the staged buffer is written back although no pointer write
+  // is pending.
+  vtkNew<vtkIntArray> source;
+  source->SetNumberOfTuples(10000);
+  source->FillValue(5);
+  array->DeepCopy(source);
+  array->ReleaseStagedValues();
+  REQUIRE(dataStore->getValue(0) == 5);
+  REQUIRE(dataStore->getValue(9999) == 5);
+}
+
+TEST_CASE("CV::Array: ranges skip NaN and are recomputed after Modified()", "[complex2VtkLib][Array]")
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const float inf = std::numeric_limits<float>::infinity();
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<float>(dataStructure, "Values", {nan, 1.0f, 3.0f, -2.0f, -1.0f, inf, 0.0f, 4.0f}, 2);
+
+  vtkSmartPointer<CV::Array<float>> array;
+  array.TakeReference(new CV::Array<float>(dataArray));
+
+  double range[2];
+  array->GetRange(range, 0);
+  REQUIRE(range[0] == -1.0);
+  REQUIRE(range[1] == 3.0);
+  array->GetRange(range, 1);
+  REQUIRE(range[0] == -2.0);
+  REQUIRE(range[1] == std::numeric_limits<double>::infinity());
+  array->GetFiniteRange(range, 1);
+  REQUIRE(range[0] == -2.0);
+  REQUIRE(range[1] == 4.0);
+
+  // Magnitudes skip the NaN tuple, the finite range also the infinite one.
+  array->GetRange(range, -1);
+  REQUIRE(range[0] == Approx(std::sqrt(13.0)));
+  REQUIRE(range[1] == std::numeric_limits<double>::infinity());
+  array->GetFiniteRange(range, -1);
+  REQUIRE(range[0] == Approx(std::sqrt(13.0)));
+  REQUIRE(range[1] == Approx(4.0));
+
+  // Writes through complex are not seen until the array is marked modified.
+  (*dataArray)[2] = 10.0f;
+  array->GetRange(range, 0);
+  REQUIRE(range[1] == 3.0);
+  array->Modified();
+  array->GetRange(range, 0);
+  REQUIRE(range[1] == 10.0);
+  array->GetFiniteRange(range, -1);
+  REQUIRE(range[1] == Approx(std::sqrt(104.0)));
+}
@@ -0,0 +1,174 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVRunLengthDataStore.hpp"
+#include "complex2VtkLib/VtkBridge/VtkBridge.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/DataStructure/Geometry/HexahedralGeom.hpp"
+#include "complex/DataStructure/Geometry/TriangleGeom.hpp"
+
+#include <vtkCell.h>
+#include <vtkCellType.h>
+#include <vtkDataSet.h>
+#include <vtkIdList.h>
+#include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkTetra.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <array>
+
+#include "TestUtilities.hpp"
+
+using namespace complex;
+
+namespace
+{
+/**
+ * @brief Creates a TriangleGeom of two triangles covering the unit square.
+ * @param dataStructure
+ * @return std::shared_ptr<TriangleGeom>
+ */
+std::shared_ptr<TriangleGeom> createTriangleGeom(DataStructure& dataStructure)
+{
+  auto vertices = CVTest::CreateArray<float32>(dataStructure, "Vertices", {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0}, 3);
+  auto triangles = CVTest::CreateArray<uint64>(dataStructure, "Triangles", {0, 1, 2, 0, 2, 3}, 3);
+  auto* geom = TriangleGeom::Create(dataStructure, "TriangleGeom");
+  geom->setVertices(*vertices);
+  geom->setFaces(*triangles);
+  return dataStructure.getSharedDataAs<TriangleGeom>(geom->getId());
+}
+
+/**
+ * @brief Creates a HexahedralGeom of one unit cube.
+ * @param dataStructure
+ * @return std::shared_ptr<HexahedralGeom>
+ */
+std::shared_ptr<HexahedralGeom> createHexahedralGeom(DataStructure& dataStructure)
+{
+  auto vertices = CVTest::CreateArray<float32>(dataStructure, "Vertices", {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1}, 3);
+  auto hexahedra = CVTest::CreateArray<uint64>(dataStructure, "Hexahedra", CVTest::Sequence<uint64>(8), 8);
+  auto* geom = HexahedralGeom::Create(dataStructure, "HexahedralGeom");
+  geom->setVertices(*vertices);
+  geom->setHexahedra(*hexahedra);
+  return dataStructure.getSharedDataAs<HexahedralGeom>(geom->getId());
+}
+
+/**
+ * @brief Returns the signed volume of a VTK_HEXAHEDRON cell as the sum of the six
+ * tetrahedra around its 0-6 diagonal. Each tetrahedron is positively oriented if the
+ * points follow VTK's order: 0-3 counterclockwise around the bottom face seen from
+ * the top, 4-7 above them. Points in another order give a different or negative volume.
+ * @param cell
+ * @return double
+ */
+double computeHexVolume(vtkCell* cell)
+{
+  const std::array<std::array<vtkIdType, 4>, 6> tets = {{{0, 1, 2, 6}, {0, 2, 3, 6}, {0, 3, 7, 6}, {0, 7, 4, 6}, {0, 4, 5, 6}, {0, 5, 1, 6}}};
+  vtkPoints* points = cell->GetPoints();
+  double volume = 0.0;
+  for(const auto& tet : tets)
+  {
+    std::array<std::array<double, 3>, 4> tetPoints = {};
+    for(usize idx = 0; idx < tet.size(); idx++)
+    {
+      points->GetPoint(tet[idx], tetPoints[idx].data());
+    }
+    volume += vtkTetra::ComputeVolume(tetPoints[0].data(), tetPoints[1].data(), tetPoints[2].data(), tetPoints[3].data());
+  }
+  return volume;
+}
+
+/**
+ * @brief Requires that both datasets have the same points and cells.
+ * @param dataSet
+ * @param expected
+ */
+void requireSameGeometry(vtkDataSet* dataSet, vtkDataSet* expected)
+{
+  REQUIRE(dataSet->GetNumberOfPoints() == expected->GetNumberOfPoints());
+  for(vtkIdType pointId = 0; pointId < expected->GetNumberOfPoints(); pointId++)
+  {
+    double point[3] = {};
+    double expectedPoint[3] = {};
+    dataSet->GetPoint(pointId, point);
+    expected->GetPoint(pointId, expectedPoint);
+    REQUIRE(point[0] == expectedPoint[0]);
+    REQUIRE(point[1] == expectedPoint[1]);
+    REQUIRE(point[2] == expectedPoint[2]);
+  }
+
+  REQUIRE(dataSet->GetNumberOfCells() == expected->GetNumberOfCells());
+  vtkNew<vtkIdList> pointIds;
+  vtkNew<vtkIdList> expectedPointIds;
+  for(vtkIdType cellId = 0; cellId < expected->GetNumberOfCells(); cellId++)
+  {
+    REQUIRE(dataSet->GetCellType(cellId) == expected->GetCellType(cellId));
+    dataSet->GetCellPoints(cellId, pointIds);
+    expected->GetCellPoints(cellId, expectedPointIds);
+    REQUIRE(pointIds->GetNumberOfIds() == expectedPointIds->GetNumberOfIds());
+    for(vtkIdType idx = 0; idx < expectedPointIds->GetNumberOfIds(); idx++)
+    {
+      REQUIRE(pointIds->GetId(idx) == expectedPointIds->GetId(idx));
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("CV::CellArrayGeom: triangle geometries match the mapped wrapper", "[complex2VtkLib][CellArrayGeom]")
+{
+  DataStructure dataStructure;
+  auto geom = createTriangleGeom(dataStructure);
+
+  auto cellArrayGeom = CV::VtkBridge::wrapGeometry(geom, CV::VtkBridge::GeometryWrapMode::CellArray);
+  auto mappedGeom = CV::VtkBridge::wrapGeometry(geom, CV::VtkBridge::GeometryWrapMode::Mapped);
+  REQUIRE(vtkPolyData::SafeDownCast(cellArrayGeom) != nullptr);
+  REQUIRE(vtkPolyData::SafeDownCast(mappedGeom) == nullptr);
+  requireSameGeometry(cellArrayGeom, mappedGeom);
+}
+
+TEST_CASE("CV::CellArrayGeom: hexahedral geometries match the mapped wrapper", "[complex2VtkLib][CellArrayGeom]")
+{
+  DataStructure dataStructure;
+  auto geom = createHexahedralGeom(dataStructure);
+
+  auto cellArrayGeom = CV::VtkBridge::wrapGeometry(geom, CV::VtkBridge::GeometryWrapMode::CellArray);
+  auto mappedGeom = CV::VtkBridge::wrapGeometry(geom, CV::VtkBridge::GeometryWrapMode::Mapped);
+  REQUIRE(vtkUnstructuredGrid::SafeDownCast(cellArrayGeom) != nullptr);
+  REQUIRE(vtkUnstructuredGrid::SafeDownCast(mappedGeom) == nullptr);
+  requireSameGeometry(cellArrayGeom, mappedGeom);
+}
+
+TEST_CASE("CV::CellArrayGeom: non-contiguous connectivity falls back to the mapped wrapper", "[complex2VtkLib][CellArrayGeom]")
+{
+  DataStructure dataStructure;
+  auto geom = createTriangleGeom(dataStructure);
+  CV::CompressDataArray(*CV::VtkBridge::findConnectivityList(geom->getFaces()));
+
+  auto dataSet = CV::VtkBridge::wrapGeometry(geom, CV::VtkBridge::GeometryWrapMode::CellArray);
+  REQUIRE(dataSet != nullptr);
+  REQUIRE(vtkPolyData::SafeDownCast(dataSet) == nullptr);
+  REQUIRE(dataSet->GetNumberOfPoints() == 4);
+  REQUIRE(dataSet->GetNumberOfCells() == 2);
+  vtkNew<vtkIdList> pointIds;
+  dataSet->GetCellPoints(1, pointIds);
+  REQUIRE(pointIds->GetId(2) == 3);
+}
+
+TEST_CASE("CV::CellArrayGeom: hexahedra use VTK's point order", "[complex2VtkLib][CellArrayGeom]")
+{
+  // complex orders the points of a hexahedron like VTK_HEXAHEDRON: the bottom face
+  // counterclockwise seen from the top, then the top face in the same order. The unit
+  // cube built that way must have volume +1 in both wrappers.
+  DataStructure dataStructure;
+  auto geom = createHexahedralGeom(dataStructure);
+
+  for(auto mode : {CV::VtkBridge::GeometryWrapMode::CellArray, CV::VtkBridge::GeometryWrapMode::Mapped})
+  {
+    auto dataSet = CV::VtkBridge::wrapGeometry(geom, mode);
+    REQUIRE(dataSet != nullptr);
+    REQUIRE(dataSet->GetCellType(0) == VTK_HEXAHEDRON);
+    REQUIRE(computeHexVolume(dataSet->GetCell(0)) == Approx(1.0));
+  }
+}
@@ -0,0 +1,141 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVComputedArray.hpp"
+#include "complex2VtkLib/VtkBridge/VtkBridge.hpp"
+
+#include "TestUtilities.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/DataStructure/NeighborList.hpp"
+
+#include <vtkDataArray.h>
+#include <vtkSmartPointer.h>
+
+#include <atomic>
+#include <string>
+
+using namespace complex;
+
+namespace
+{
+using ComputedArrayType = CV::ComputedArray<double>;
+
+/**
+ * @brief Creates a ComputedArray whose value at (tuple, comp) is
+ * offset + tuple * numComps + comp. Every kernel call increments kernelCalls.
+ * @param numTuples
+ * @param numComps
+ * @param offset
+ * @param kernelCalls
+ * @return vtkSmartPointer<ComputedArrayType>
+ */
+vtkSmartPointer<ComputedArrayType> createCountingArray(vtkIdType numTuples, vtkIdType numComps, const double& offset, std::atomic<int>& kernelCalls)
+{
+  auto kernel = [numComps, &offset, &kernelCalls](vtkIdType beginTuple, vtkIdType endTuple, double* output) {
+    kernelCalls++;
+    for(vtkIdType valueIdx = beginTuple * numComps; valueIdx < endTuple * numComps; valueIdx++)
+    {
+      output[valueIdx - beginTuple * numComps] = offset + static_cast<double>(valueIdx);
+    }
+  };
+  vtkSmartPointer<ComputedArrayType> array;
+  array.TakeReference(new ComputedArrayType(numTuples, numComps, kernel));
+  return array;
+}
+} // namespace
+
+TEST_CASE("CV::ComputedArray: evicted chunks are recomputed", "[complex2VtkLib][ComputedArray]")
+{
+  const double offset = 0.0;
+  std::atomic<int> kernelCalls = 0;
+  auto array = createCountingArray(20, 1, offset, kernelCalls);
+  array->SetChunkSize(10);
+  array->SetMaxCachedChunks(1);
+  REQUIRE(array->GetChunkSize() == 10);
+  REQUIRE(array->GetMaxCachedChunks() == 1);
+
+  REQUIRE(array->GetValue(0) == 0.0);
+  REQUIRE(array->GetValue(9) == 9.0);
+  REQUIRE(kernelCalls == 1);
+
+  // Reading the second chunk evicts the first.
+  REQUIRE(array->GetValue(15) == 15.0);
+  REQUIRE(kernelCalls == 2);
+  REQUIRE(array->GetValue(3) == 3.0);
+  REQUIRE(kernelCalls == 3);
+
+  // With room for both chunks, only the evicted second chunk is computed again.
+  array->SetMaxCachedChunks(2);
+  REQUIRE(array->GetValue(15) == 15.0);
+  REQUIRE(kernelCalls == 4);
+  REQUIRE(array->GetValue(4) == 4.0);
+  REQUIRE(array->GetValue(16) == 16.0);
+  REQUIRE(kernelCalls == 4);
+}
+
+TEST_CASE("CV::ComputedArray: Modified() recomputes cached chunks", "[complex2VtkLib][ComputedArray]")
+{
+  double offset = 0.0;
+  std::atomic<int> kernelCalls = 0;
+  auto array = createCountingArray(8, 1, offset, kernelCalls);
+
+  REQUIRE(array->GetValue(5) == 5.0);
+  REQUIRE(array->GetValue(5) == 5.0);
+  REQUIRE(kernelCalls == 1);
+
+  // The kernel's input changes; the cached values stay until Modified().
+  offset = 100.0;
+  REQUIRE(array->GetValue(5) == 5.0);
+  array->Modified();
+  REQUIRE(array->GetValue(5) == 105.0);
+  REQUIRE(array->GetValue(0) == 100.0);
+  REQUIRE(kernelCalls == 2);
+}
+
+TEST_CASE("CV::ComputedArray: GetTypedTuple sweeps across chunks", "[complex2VtkLib][ComputedArray]")
+{
+  const double offset = 0.0;
+  std::atomic<int> kernelCalls = 0;
+  const vtkIdType numTuples = 50;
+  auto array = createCountingArray(numTuples, 3, offset, kernelCalls);
+  array->SetChunkSize(7);
+  array->SetMaxCachedChunks(2);
+
+  double tuple[3];
+  for(vtkIdType tupleIdx = 0; tupleIdx < numTuples; tupleIdx++)
+  {
+    array->GetTypedTuple(tupleIdx, tuple);
+    for(int comp = 0; comp < 3; comp++)
+    {
+      REQUIRE(tuple[comp] == static_cast<double>(tupleIdx * 3 + comp));
+      REQUIRE(array->GetTypedComponent(tupleIdx, comp) == tuple[comp]);
+    }
+  }
+  // Each of the ceil(50 / 7) chunks is computed exactly once by a forward sweep.
+  REQUIRE(kernelCalls == 8);
+}
+
+TEST_CASE("CV::VtkBridge: wrapMagnitude computes tuple magnitudes", "[complex2VtkLib][ComputedArray]")
+{
+  DataStructure dataStructure;
+  auto vectors = CVTest::CreateArray<float32>(dataStructure, "Vectors", {3.0f, 4.0f, 0.0f, 0.0f, 0.0f, -2.0f, 1.0f, 2.0f, 2.0f}, 3);
+
+  vtkSmartPointer<vtkDataArray> magnitude;
+  magnitude.TakeReference(CV::VtkBridge::wrapMagnitude(vectors));
+  REQUIRE(magnitude != nullptr);
+  REQUIRE(std::string(magnitude->GetName()) == "Vectors_Magnitude");
+  REQUIRE(magnitude->GetNumberOfTuples() == 3);
+  REQUIRE(magnitude->GetNumberOfComponents() == 1);
+  REQUIRE(magnitude->GetComponent(0, 0) == Approx(5.0));
+  REQUIRE(magnitude->GetComponent(1, 0) == Approx(2.0));
+  REQUIRE(magnitude->GetComponent(2, 0) == Approx(3.0));
+
+  // Changes to the wrapped array show up once the magnitude is marked modified.
+  (*vectors)[0] = 6.0f;
+  (*vectors)[1] = 8.0f;
+  magnitude->Modified();
+  REQUIRE(magnitude->GetComponent(0, 0) == Approx(10.0));
+
+  auto* neighborList = NeighborList<int32>::Create(dataStructure, "Neighbors", 2);
+  REQUIRE(CV::VtkBridge::wrapMagnitude(dataStructure.getSharedData(neighborList->getId())) == nullptr);
+}
@@ -0,0 +1,40 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVDirtyTupleRanges.hpp"
+
+#include <vector>
+
+TEST_CASE("CV::DirtyTupleRanges: marks are coalesced into block ranges", "[complex2VtkLib][DirtyTupleRanges]")
+{
+  // Blocks of 4 tuples, the last one holding only 2
+  CV::DirtyTupleRanges dirtyRanges(102, 2);
+  REQUIRE(dirtyRanges.getBlockSize() == 4);
+  REQUIRE(dirtyRanges.isEmpty());
+
+  dirtyRanges.markTuple(5);
+  dirtyRanges.markTuple(8);
+  dirtyRanges.markTuple(101);
+  const std::vector<CV::DirtyTupleRanges::RangeType> expected = {{4, 12}, {100, 102}};
+  REQUIRE(dirtyRanges.getRanges() == expected);
+  REQUIRE(dirtyRanges.getNumberOfDirtyTuples() == 10);
+
+  dirtyRanges.clear();
+  REQUIRE(dirtyRanges.isEmpty());
+}
+
+TEST_CASE("CV::DirtyTupleRanges: tuples beyond the tracked size are ignored", "[complex2VtkLib][DirtyTupleRanges]")
+{
+  // 26 blocks share the first word with 38 untracked block bits
+  CV::DirtyTupleRanges dirtyRanges(102, 2);
+  dirtyRanges.markTuple(104);
+  dirtyRanges.markTuple(255);
+  dirtyRanges.markTuple(100000);
+  REQUIRE(dirtyRanges.isEmpty());
+  REQUIRE(dirtyRanges.getRanges().empty());
+
+  // Growing the tracker must not reveal marks of tuples that were out of range.
+  dirtyRanges.resize(256);
+  REQUIRE(dirtyRanges.isEmpty());
+  dirtyRanges.markTuple(255);
+  REQUIRE(dirtyRanges.getNumberOfDirtyTuples() == 4);
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVFeatureGatherArray.hpp"
+#include "complex2VtkLib/VtkBridge/VtkBridge.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+
+#include <vtkFloatArray.h>
+#include <vtkIdList.h>
+#include <vtkSmartPointer.h>
+
+#include "TestUtilities.hpp"
+
+using namespace complex;
+
+TEST_CASE("CV::FeatureGatherArray: tuples are gathered through the feature ids", "[complex2VtkLib][FeatureGatherArray]")
+{
+  DataStructure dataStructure;
+  auto featureIds = CVTest::CreateArray<int32>(dataStructure, "FeatureIds", {1, 2, 2, 0, 1});
+  auto featureArray = CVTest::CreateArray<float>(dataStructure, "Centroids", CVTest::Sequence<float>(6), 2);
+
+  vtkSmartPointer<CV::FeatureGatherArray<float>> array;
+  array.TakeReference(new CV::FeatureGatherArray<float>(featureIds, featureArray));
+  REQUIRE(array->HasValidFeatureIds());
+  REQUIRE(array->GetNumberOfTuples() == 5);
+  REQUIRE(array->GetNumberOfComponents() == 2);
+  REQUIRE(array->GetTypedComponent(1, 1) == 5.0f);
+
+  auto output = vtkSmartPointer<vtkFloatArray>::New();
+  output->SetNumberOfComponents(2);
+  output->SetNumberOfTuples(5);
+  array->GetTuples(0, 4, output);
+  REQUIRE(output->GetTypedComponent(0, 0) == 2.0f);
+  REQUIRE(output->GetTypedComponent(3, 1) == 1.0f);
+
+  auto ids = vtkSmartPointer<vtkIdList>::New();
+  ids->InsertNextId(4);
+  ids->InsertNextId(2);
+  array->GetTuples(ids, output);
+  REQUIRE(output->GetTypedComponent(0, 0) == 2.0f);
+  REQUIRE(output->GetTypedComponent(1, 0) == 4.0f);
+}
+
+TEST_CASE("CV::FeatureGatherArray: out of range ids are rejected", "[complex2VtkLib][FeatureGatherArray]")
+{
+  DataStructure dataStructure;
+  auto featureIds = CVTest::CreateArray<int32>(dataStructure, "FeatureIds", {1, 2, 7, 0});
+  auto featureArray = CVTest::CreateArray<float>(dataStructure, "Volumes", {10.0f, 11.0f, 12.0f});
+
+  vtkSmartPointer<CV::FeatureGatherArray<float>> array;
+  array.TakeReference(new CV::FeatureGatherArray<float>(featureIds, featureArray));
+  REQUIRE_FALSE(array->HasValidFeatureIds());
+
+  vtkSmartPointer<vtkDataArray> wrapped;
+  wrapped.TakeReference(CV::VtkBridge::wrapFeatureArray(featureIds, featureArray));
+  REQUIRE(wrapped == nullptr);
+
+  auto output = vtkSmartPointer<vtkFloatArray>::New();
+  output->SetNumberOfTuples(4);
+  output->FillValue(-1.0f);
+
+  auto ids = vtkSmartPointer<vtkIdList>::New();
+  ids->InsertNextId(1);
+  ids->InsertNextId(9);
+  array->GetTuples(ids, output);
+  REQUIRE(output->GetValue(0) == 12.0f);
+  REQUIRE(output->GetValue(1) == -1.0f);
+
+  output->FillValue(-1.0f);
+  ids->Reset();
+  ids->InsertNextId(2);
+  array->GetTuples(ids, output);
+  REQUIRE(output->GetValue(0) == -1.0f);
+}
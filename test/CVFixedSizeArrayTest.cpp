@@ -0,0 +1,34 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVComponentView.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+
+#include <vtkAOSDataArrayTemplate.h>
+#include <vtkSmartPointer.h>
+
+#include "TestUtilities.hpp"
+
+using namespace complex;
+
+TEST_CASE("CV::ComponentView: fixed size views reject resizing and create AOS instances", "[complex2VtkLib][FixedSizeArray]")
+{
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<float>(dataStructure, "Vectors", CVTest::Sequence<float>(12), 3);
+
+  vtkSmartPointer<CV::ComponentView<float>> view;
+  view.TakeReference(CV::ComponentView<float>::New());
+  view->SetComplexArray(dataArray, 1);
+  REQUIRE(view->GetNumberOfTuples() == 4);
+  REQUIRE(view->GetValue(2) == 7.0f);
+
+  REQUIRE(view->Resize(4));
+  REQUIRE_FALSE(view->Resize(8));
+  REQUIRE(view->GetNumberOfTuples() == 4);
+
+  vtkSmartPointer<vtkDataArray> instance;
+  instance.TakeReference(view->NewInstance());
+  REQUIRE(vtkAOSDataArrayTemplate<float>::SafeDownCast(instance) != nullptr);
+  instance->SetNumberOfTuples(8);
+  REQUIRE(instance->GetNumberOfTuples() == 8);
+}
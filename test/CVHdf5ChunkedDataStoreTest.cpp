@@ -0,0 +1,200 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVComponentView.hpp"
+#include "complex2VtkLib/VtkBridge/CVDirtyTupleWriter.hpp"
+#include "complex2VtkLib/VtkBridge/CVHdf5ChunkedDataStore.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+
+#include <vtkCallbackCommand.h>
+#include <vtkCommand.h>
+#include <vtkIntArray.h>
+#include <vtkNew.h>
+#include <vtkSmartPointer.h>
+
+#include "TestUtilities.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
+using namespace complex;
+
+namespace
+{
+constexpr hsize_t k_NumRows = 1000;
+constexpr hsize_t k_NumComps = 4;
+
+/**
+ * @brief Writes a k_NumRows x k_NumComps int32 dataset "Values" with the values
+ * 0, 1, 2, ... to a new HDF5 file in the temp directory and returns its path.
+ * @param fileName
+ * @return std::filesystem::path
+ */
+std::filesystem::path writeHdf5File(const std::string& fileName)
+{
+  const std::filesystem::path filePath = std::filesystem::temp_directory_path() / fileName;
+  std::vector<int32> values(k_NumRows * k_NumComps);
+  for(usize idx = 0; idx < values.size(); idx++)
+  {
+    values[idx] = static_cast<int32>(idx);
+  }
+
+  std::lock_guard<std::mutex> lock(CV::Hdf5LibraryMutex());
+  const hsize_t dims[2] = {k_NumRows, k_NumComps};
+  hid_t fileId = H5Fcreate(filePath.string().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  hid_t space = H5Screate_simple(2, dims, nullptr);
+  hid_t dataset = H5Dcreate2(fileId, "Values", H5T_NATIVE_INT32, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  H5Dwrite(dataset, H5T_NATIVE_INT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data());
+  H5Dclose(dataset);
+  H5Sclose(space);
+  H5Fclose(fileId);
+  return filePath;
+}
+} // namespace
+
+TEST_CASE("CV::Hdf5ChunkedDataStore: values are read chunk by chunk", "[complex2VtkLib][Hdf5ChunkedDataStore]")
+{
+  const auto filePath = writeHdf5File("CVHdf5ChunkedDataStoreTest.h5");
+  {
+    CV::Hdf5ChunkedDataStore<int32> dataStore(filePath, "Values", {k_NumRows}, {k_NumComps});
+    REQUIRE(dataStore.getPrefetchChunks() == (CV::IsHdf5LibraryThreadSafe() ? CV::Hdf5ChunkedDataStore<int32>::k_DefaultPrefetchChunks : 0));
+
+    // 100 rows of 4 values per chunk
+    dataStore.setChunkBytes(100 * k_NumComps * sizeof(int32));
+    dataStore.setPrefetchChunks(0);
+    for(usize idx = 0; idx < k_NumRows * k_NumComps; idx++)
+    {
+      REQUIRE(dataStore.getValue(idx) == static_cast<int32>(idx));
+    }
+    REQUIRE(dataStore.getNumberOfChunkReads() == 10);
+
+    // Reading chunk 0 first counts as sequential, so chunk 1 is read ahead and not
+    // read again when it is requested.
+    dataStore.setChunkBytes(100 * k_NumComps * sizeof(int32));
+    dataStore.setPrefetchChunks(1);
+    REQUIRE(dataStore.getValue(0) == 0);
+    dataStore.setPrefetchChunks(0);
+    REQUIRE(dataStore.getValue(400) == 400);
+    REQUIRE(dataStore.getNumberOfChunkReads() == 12);
+  }
+  std::filesystem::remove(filePath);
+}
+
+TEST_CASE("CV::Hdf5ChunkedDataStore: chunked arrays can be viewed", "[complex2VtkLib][Hdf5ChunkedDataStore]")
+{
+  const auto filePath = writeHdf5File("CVHdf5ChunkedDataStoreViewTest.h5");
+  {
+    DataStructure dataStructure;
+    auto* dataArray = CV::CreateHdf5DataArray<int32>(filePath, "Values", "Values", dataStructure, {k_NumRows}, {k_NumComps});
+    auto sharedArray = dataStructure.getSharedDataAs<DataArray<int32>>(dataArray->getId());
+
+    vtkSmartPointer<CV::ComponentView<int32>> view;
+    view.TakeReference(CV::ComponentView<int32>::New());
+    view->SetComplexArray(sharedArray, 3);
+    REQUIRE(view->GetNumberOfTuples() == static_cast<vtkIdType>(k_NumRows));
+    REQUIRE(view->GetValue(0) == 3);
+    REQUIRE(view->GetValue(999) == 3999);
+  }
+  std::filesystem::remove(filePath);
+}
+
+TEST_CASE("CV::Hdf5ChunkedDataStore: dirty tuples can be written to a file open for reading", "[complex2VtkLib][Hdf5ChunkedDataStore]")
+{
+  const auto filePath = writeHdf5File("CVHdf5ChunkedDataStoreWriteTest.h5");
+  {
+    CV::Hdf5ChunkedDataStore<int32> dataStore(filePath, "Values", {k_NumRows}, {k_NumComps});
+    dataStore.setPrefetchChunks(0);
+    REQUIRE(dataStore.getValue(40) == 40);
+
+    DataStructure dataStructure;
+    std::vector<int32> values = CVTest::Sequence<int32>(k_NumRows * k_NumComps);
+    std::fill(values.begin() + 40, values.begin() + 80, -1);
+    auto dataArray = CVTest::CreateArray<int32>(dataStructure, "Values", values, k_NumComps);
+
+    // One tuple per block, so exactly the tuples 10 to 19 are written
+    CV::DirtyTupleRanges dirtyRanges(k_NumRows, 0);
+    dirtyRanges.markTuples(10, 20);
+    REQUIRE(CV::WriteDirtyTuples(*dataArray, dirtyRanges, filePath, "Values") == 10);
+    REQUIRE(dirtyRanges.isEmpty());
+
+    // The store was closed for writing and reopened, which dropped its cached chunks.
+    REQUIRE(dataStore.getValue(39) == 39);
+    REQUIRE(dataStore.getValue(40) == -1);
+    REQUIRE(dataStore.getValue(79) == -1);
+    REQUIRE(dataStore.getValue(80) == 80);
+  }
+  std::filesystem::remove(filePath);
+}
+
+TEST_CASE("CV::Hdf5ChunkedDataStore: references stay valid while other chunks are read", "[complex2VtkLib][Hdf5ChunkedDataStore]")
+{
+  const auto filePath = writeHdf5File("CVHdf5ChunkedDataStoreReferenceTest.h5");
+  {
+    CV::Hdf5ChunkedDataStore<int32> dataStore(filePath, "Values", {k_NumRows}, {k_NumComps});
+    dataStore.setPrefetchChunks(0);
+    // 100 rows per chunk and room for a single chunk in the cache
+    dataStore.setChunkBytes(100 * k_NumComps * sizeof(int32));
+    dataStore.setCacheBytes(100 * k_NumComps * sizeof(int32));
+
+    const int32& first = dataStore[0];
+    const int32& last = dataStore.at(k_NumRows * k_NumComps - 1);
+    for(usize idx = 0; idx < k_NumRows * k_NumComps; idx += 400)
+    {
+      REQUIRE(dataStore.getValue(idx) == static_cast<int32>(idx));
+    }
+    REQUIRE(dataStore.getNumberOfPinnedChunks() == 2);
+    REQUIRE(first == 0);
+    REQUIRE(last == static_cast<int32>(k_NumRows * k_NumComps - 1));
+
+    // Dropping the cache keeps the pinned values alive, later calls pin the chunk again.
+    dataStore.setChunkBytes(100 * k_NumComps * sizeof(int32));
+    REQUIRE(dataStore.getNumberOfPinnedChunks() == 0);
+    REQUIRE(first == 0);
+    REQUIRE(dataStore[1] == 1);
+    REQUIRE(dataStore.getNumberOfPinnedChunks() == 1);
+
+    dataStore.releasePinnedChunks();
+    REQUIRE(dataStore.getNumberOfPinnedChunks() == 0);
+    REQUIRE(dataStore[2] == 2);
+  }
+  std::filesystem::remove(filePath);
+}
+
+TEST_CASE("CV::Hdf5ChunkedDataStore: writes to staged chunked arrays are reported", "[complex2VtkLib][Hdf5ChunkedDataStore]")
+{
+  const auto filePath = writeHdf5File("CVHdf5ChunkedDataStoreStagingTest.h5");
+  {
+    DataStructure dataStructure;
+    auto* dataArray = CV::CreateHdf5DataArray<int32>(filePath, "Values", "Values", dataStructure, {k_NumRows}, {k_NumComps});
+    auto sharedArray = dataStructure.getSharedDataAs<DataArray<int32>>(dataArray->getId());
+
+    vtkSmartPointer<CV::Array<int32>> array;
+    array.TakeReference(new CV::Array<int32>(sharedArray));
+    int numErrors = 0;
+    vtkNew<vtkCallbackCommand> errorObserver;
+    errorObserver->SetClientData(&numErrors);
+    errorObserver->SetCallback([](vtkObject*, unsigned long, void* clientData, void*) { (*static_cast<int*>(clientData))++; });
+    array->AddObserver(vtkCommand::ErrorEvent, errorObserver);
+
+    REQUIRE(array->GetVoidPointer(0) != nullptr);
+    array->DataChanged();
+    REQUIRE(numErrors == 0);
+
+    array->SetValue(5, -1);
+    vtkNew<vtkIntArray> output;
+    output->SetNumberOfComponents(k_NumComps);
+    output->SetNumberOfTuples(2);
+    array->GetTuples(0, 1, output);
+    REQUIRE(output->GetValue(5) == -1);
+
+    array->DataChanged();
+    REQUIRE(numErrors == 1);
+    array->ReleaseStagedValues();
+    REQUIRE(numErrors == 1);
+    REQUIRE(array->GetValue(5) == 5);
+  }
+  std::filesystem::remove(filePath);
+}
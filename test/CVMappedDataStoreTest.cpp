@@ -0,0 +1,69 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVMappedDataStore.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Writes the values to a raw binary file in the temp directory and returns its path.
+ * @param fileName
+ * @param values
+ * @return std::filesystem::path
+ */
+std::filesystem::path writeRawFile(const std::string& fileName, const std::vector<int32_t>& values)
+{
+  const std::filesystem::path filePath = std::filesystem::temp_directory_path() / fileName;
+  std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(int32_t)));
+  return filePath;
+}
+
+/**
+ * @brief Reads the raw binary file back.
+ * @param filePath
+ * @param numValues
+ * @return std::vector<int32_t>
+ */
+std::vector<int32_t> readRawFile(const std::filesystem::path& filePath, size_t numValues)
+{
+  std::vector<int32_t> values(numValues);
+  std::ifstream file(filePath, std::ios::binary);
+  file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(numValues * sizeof(int32_t)));
+  return values;
+}
+} // namespace
+
+TEST_CASE("CV::MappedDataStore: copy-on-write stores never modify the file", "[complex2VtkLib][MappedDataStore]")
+{
+  const auto filePath = writeRawFile("CVMappedDataStoreTest_ReadOnly.raw", {1, 2, 3, 4});
+  {
+    CV::MappedDataStore<int32_t> dataStore(filePath, {4}, {1});
+    REQUIRE(dataStore.getStoreType() == complex::IDataStore::StoreType::OutOfCore);
+    REQUIRE_FALSE(dataStore.isWritable());
+    REQUIRE(dataStore.getValue(2) == 3);
+
+    dataStore.setValue(2, 30);
+    REQUIRE(dataStore.getValue(2) == 30);
+    dataStore.flush();
+  }
+  REQUIRE(readRawFile(filePath, 4) == std::vector<int32_t>{1, 2, 3, 4});
+  std::filesystem::remove(filePath);
+}
+
+TEST_CASE("CV::MappedDataStore: writable stores write through to the file", "[complex2VtkLib][MappedDataStore]")
+{
+  const auto filePath = writeRawFile("CVMappedDataStoreTest_Writable.raw", {1, 2, 3, 4});
+  {
+    CV::MappedDataStore<int32_t> dataStore(filePath, {4}, {1}, true);
+    REQUIRE(dataStore.isWritable());
+    dataStore.setValue(2, 30);
+    dataStore.data()[3] = 40;
+    dataStore.flush();
+    REQUIRE(readRawFile(filePath, 4) == std::vector<int32_t>{1, 2, 30, 40});
+  }
+  std::filesystem::remove(filePath);
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVNeighborListArray.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/DataStructure/NeighborList.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkIdList.h>
+#include <vtkSmartPointer.h>
+
+using namespace complex;
+
+namespace
+{
+/**
+ * @brief Creates a NeighborList with the lists {0, 1, 2}, {}, {3} and {4, 5}.
+ * @param dataStructure
+ * @return std::shared_ptr<NeighborList<int32>>
+ */
+std::shared_ptr<NeighborList<int32>> createNeighborList(DataStructure& dataStructure)
+{
+  auto* neighborList = NeighborList<int32>::Create(dataStructure, "Neighbors", 4);
+  const std::vector<std::vector<int32>> lists = {{0, 1, 2}, {}, {3}, {4, 5}};
+  for(usize listIdx = 0; listIdx < lists.size(); listIdx++)
+  {
+    neighborList->setList(static_cast<int32>(listIdx), std::make_shared<std::vector<int32>>(lists[listIdx]));
+  }
+  return dataStructure.getSharedDataAs<NeighborList<int32>>(neighborList->getId());
+}
+} // namespace
+
+TEST_CASE("CV::NeighborListArray: values are read from the lists next to the offsets", "[complex2VtkLib][NeighborListArray]")
+{
+  DataStructure dataStructure;
+  auto neighborList = createNeighborList(dataStructure);
+
+  vtkSmartPointer<CV::NeighborListArray<int32>> array;
+  array.TakeReference(new CV::NeighborListArray<int32>(neighborList));
+
+  REQUIRE(array->GetNumberOfLists() == 4);
+  REQUIRE(array->GetNumberOfTuples() == 6);
+  REQUIRE(array->GetOffsetsArray()->GetValue(2) == 3);
+  REQUIRE(array->GetOffsetsArray()->GetValue(4) == 6);
+  for(vtkIdType valueIdx = 0; valueIdx < 6; valueIdx++)
+  {
+    REQUIRE(array->GetValue(valueIdx) == static_cast<int32>(valueIdx));
+  }
+  // Backwards and jumping reads do not follow the cursor.
+  for(vtkIdType valueIdx = 5; valueIdx >= 0; valueIdx -= 2)
+  {
+    REQUIRE(array->GetValue(valueIdx) == static_cast<int32>(valueIdx));
+  }
+  REQUIRE(array->GetValue(0) == 0);
+  REQUIRE(array->GetValue(5) == 5);
+
+  array->SetValue(3, 30);
+  REQUIRE(neighborList->getList(2)->at(0) == 30);
+  REQUIRE(array->GetValue(3) == 30);
+}
+
+TEST_CASE("CV::NeighborListArray: integral lists back a vtkCellArray", "[complex2VtkLib][NeighborListArray]")
+{
+  DataStructure dataStructure;
+  auto neighborList = createNeighborList(dataStructure);
+
+  vtkSmartPointer<CV::NeighborListArray<int32>> array;
+  array.TakeReference(new CV::NeighborListArray<int32>(neighborList));
+  vtkSmartPointer<vtkCellArray> cellArray = array->CreateCellArray();
+
+  REQUIRE(cellArray->GetNumberOfCells() == 4);
+  REQUIRE(cellArray->GetNumberOfConnectivityIds() == 6);
+  REQUIRE(cellArray->GetConnectivityArray()->GetComponent(4, 0) == 4.0);
+
+  auto cellPoints = vtkSmartPointer<vtkIdList>::New();
+  cellArray->GetCellAtId(3, cellPoints);
+  REQUIRE(cellPoints->GetNumberOfIds() == 2);
+  REQUIRE(cellPoints->GetId(1) == 5);
+  cellArray->GetCellAtId(1, cellPoints);
+  REQUIRE(cellPoints->GetNumberOfIds() == 0);
+}
+
+TEST_CASE("CV::NeighborListArray: sweeps skip runs of empty lists", "[complex2VtkLib][NeighborListArray]")
+{
+  DataStructure dataStructure;
+  const int32 numLists = 1000;
+  auto* neighborList = NeighborList<int32>::Create(dataStructure, "Sparse", numLists);
+  int32 value = 0;
+  for(int32 listIdx = 0; listIdx < numLists; listIdx++)
+  {
+    // Every 20th list holds two values, the others are empty.
+    auto list = std::make_shared<std::vector<int32>>();
+    if(listIdx % 20 == 0)
+    {
+      list->push_back(value++);
+      list->push_back(value++);
+    }
+    neighborList->setList(listIdx, list);
+  }
+  auto sharedList = dataStructure.getSharedDataAs<NeighborList<int32>>(neighborList->getId());
+
+  vtkSmartPointer<CV::NeighborListArray<int32>> array;
+  array.TakeReference(new CV::NeighborListArray<int32>(sharedList));
+  REQUIRE(array->GetNumberOfTuples() == value);
+  for(vtkIdType valueIdx = 0; valueIdx < value; valueIdx++)
+  {
+    REQUIRE(array->GetValue(valueIdx) == static_cast<int32>(valueIdx));
+  }
+
+  array->SetValue(99, -1);
+  REQUIRE(sharedList->getList(980)->at(1) == -1);
+}
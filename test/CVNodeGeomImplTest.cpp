@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVTriangleGeom.hpp"
+#include "complex2VtkLib/VtkBridge/VtkBridge.hpp"
+
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/DataStructure/Geometry/TriangleGeom.hpp"
+
+#include <vtkCellIterator.h>
+#include <vtkDataSet.h>
+#include <vtkIdList.h>
+#include <vtkNew.h>
+#include <vtkSmartPointer.h>
+
+#include "TestUtilities.hpp"
+
+using namespace complex;
+
+TEST_CASE("CV::NodeGeomImpl: a replaced connectivity store is picked up", "[complex2VtkLib][NodeGeomImpl]")
+{
+  DataStructure dataStructure;
+  auto vertices = CVTest::CreateArray<float32>(dataStructure, "Vertices", {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0}, 3);
+  auto triangles = CVTest::CreateArray<uint64>(dataStructure, "Triangles", {0, 1, 2, 0, 2, 3}, 3);
+  auto* triangleGeom = TriangleGeom::Create(dataStructure, "TriangleGeom");
+  triangleGeom->setVertices(*vertices);
+  triangleGeom->setFaces(*triangles);
+  auto geom = dataStructure.getSharedDataAs<TriangleGeom>(triangleGeom->getId());
+
+  auto dataSet = CV::VtkBridge::wrapGeometry(geom, CV::VtkBridge::GeometryWrapMode::Mapped);
+  auto* grid = CV::CVTriangleGrid::SafeDownCast(dataSet);
+  REQUIRE(grid != nullptr);
+
+  vtkNew<vtkIdList> ids;
+  grid->GetCellPoints(1, ids);
+  REQUIRE(ids->GetId(1) == 2);
+  grid->GetPointCells(2, ids);
+  REQUIRE(ids->GetNumberOfIds() == 2);
+
+  // Replace the store behind the wrapper's back: the other diagonal.
+  auto replacement = std::make_shared<DataStore<uint64>>(std::vector<usize>{2}, std::vector<usize>{3});
+  const std::vector<uint64> values = {0, 1, 3, 1, 2, 3};
+  for(usize idx = 0; idx < values.size(); idx++)
+  {
+    replacement->setValue(idx, values[idx]);
+  }
+  triangles->setDataStore(replacement);
+
+  // Starting a traversal looks the connectivity up again.
+  vtkSmartPointer<vtkCellIterator> cellIter;
+  cellIter.TakeReference(grid->NewCellIterator());
+  cellIter->InitTraversal();
+  cellIter->GoToNextCell();
+  REQUIRE_FALSE(cellIter->IsDoneWithTraversal());
+  REQUIRE(cellIter->GetPointIds()->GetId(0) == 1);
+  REQUIRE(cellIter->GetPoints()->GetPoint(0)[0] == 1.0);
+  REQUIRE(grid->GetImplementation()->GetConnectivityPointer() == replacement->data());
+
+  grid->GetCellPoints(1, ids);
+  REQUIRE(ids->GetId(0) == 1);
+  REQUIRE(ids->GetId(1) == 2);
+  REQUIRE(ids->GetId(2) == 3);
+
+  // The point to cell links are keyed on the store and rebuilt.
+  grid->GetPointCells(2, ids);
+  REQUIRE(ids->GetNumberOfIds() == 1);
+  REQUIRE(ids->GetId(0) == 1);
+  grid->GetPointCells(3, ids);
+  REQUIRE(ids->GetNumberOfIds() == 2);
+
+  // Direct cell access needs Modified() after the store was replaced.
+  auto original = std::make_shared<DataStore<uint64>>(std::vector<usize>{2}, std::vector<usize>{3});
+  const std::vector<uint64> originalValues = {0, 1, 2, 0, 2, 3};
+  for(usize idx = 0; idx < originalValues.size(); idx++)
+  {
+    original->setValue(idx, originalValues[idx]);
+  }
+  triangles->setDataStore(original);
+  grid->GetImplementation()->Modified();
+  grid->GetCellPoints(1, ids);
+  REQUIRE(ids->GetId(0) == 0);
+  REQUIRE(ids->GetId(1) == 2);
+  REQUIRE(ids->GetId(2) == 3);
+}
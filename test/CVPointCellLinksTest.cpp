@@ -0,0 +1,95 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVPointCellLinks.hpp"
+
+#include <vtkNew.h>
+
+#include <utility>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Returns the connectivity of a line strip: cell i uses points i and i + 1.
+ * @param numCells
+ * @return std::vector<size_t>
+ */
+std::vector<size_t> CreateLineStrip(size_t numCells)
+{
+  std::vector<size_t> connectivity(numCells * 2);
+  for(size_t cellId = 0; cellId < numCells; cellId++)
+  {
+    connectivity[cellId * 2] = cellId;
+    connectivity[cellId * 2 + 1] = cellId + 1;
+  }
+  return connectivity;
+}
+} // namespace
+
+TEST_CASE("CV::PointCellLinks: links span several scan blocks", "[complex2VtkLib][PointCellLinks]")
+{
+  // More points than one prefix sum block.
+  const size_t numCells = 200000;
+  const std::vector<size_t> connectivity = CreateLineStrip(numCells);
+
+  CV::PointCellLinks links;
+  links.ensureBuilt(
+      connectivity.data(), connectivity.size(), 2, [numCells]() { return std::make_pair(numCells + 1, numCells); },
+      [&connectivity](size_t cellId, size_t* verts) {
+        verts[0] = connectivity[cellId * 2];
+        verts[1] = connectivity[cellId * 2 + 1];
+      });
+  REQUIRE(links.isBuilt());
+  REQUIRE(links.getNumberOfCells(0) == 1);
+  REQUIRE(links.getNumberOfCells(numCells) == 1);
+
+  vtkNew<vtkIdList> cellIds;
+  for(vtkIdType ptId : {vtkIdType(1), vtkIdType(65535), vtkIdType(65536), vtkIdType(131073), vtkIdType(numCells - 1)})
+  {
+    links.getPointCells(ptId, cellIds);
+    REQUIRE(cellIds->GetNumberOfIds() == 2);
+    REQUIRE(cellIds->GetId(0) == ptId - 1);
+    REQUIRE(cellIds->GetId(1) == ptId);
+  }
+}
+
+TEST_CASE("CV::PointCellLinks: links are rebuilt when the connectivity changes", "[complex2VtkLib][PointCellLinks]")
+{
+  std::vector<size_t> connectivity = CreateLineStrip(4);
+  int numSizeQueries = 0;
+  auto getSizes = [&connectivity, &numSizeQueries]() {
+    numSizeQueries++;
+    const size_t numCells = connectivity.size() / 2;
+    return std::make_pair(numCells + 1, numCells);
+  };
+  auto getCellPoints = [&connectivity](size_t cellId, size_t* verts) {
+    verts[0] = connectivity[cellId * 2];
+    verts[1] = connectivity[cellId * 2 + 1];
+  };
+
+  CV::PointCellLinks links;
+  links.ensureBuilt(&connectivity, connectivity.size(), 2, getSizes, getCellPoints);
+  REQUIRE(numSizeQueries == 1);
+  REQUIRE(links.getNumberOfCells(4) == 1);
+
+  // Built for the same connectivity: no sizes are queried.
+  links.ensureBuilt(&connectivity, connectivity.size(), 2, getSizes, getCellPoints);
+  REQUIRE(numSizeQueries == 1);
+
+  // A resized connectivity store is detected.
+  connectivity = CreateLineStrip(6);
+  links.ensureBuilt(&connectivity, connectivity.size(), 2, getSizes, getCellPoints);
+  REQUIRE(numSizeQueries == 2);
+  REQUIRE(links.getNumberOfCells(4) == 2);
+  REQUIRE(links.getNumberOfCells(6) == 1);
+
+  // So is a replaced one.
+  std::vector<size_t> replacement = {0, 6, 1, 6, 2, 6, 3, 6, 4, 6, 5, 6};
+  links.ensureBuilt(&replacement, replacement.size(), 2, getSizes, [&replacement](size_t cellId, size_t* verts) {
+    verts[0] = replacement[cellId * 2];
+    verts[1] = replacement[cellId * 2 + 1];
+  });
+  REQUIRE(numSizeQueries == 3);
+  REQUIRE(links.getNumberOfCells(6) == 6);
+  REQUIRE(links.getNumberOfCells(4) == 1);
+}
@@ -0,0 +1,109 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVRectGridGeom.hpp"
+#include "complex2VtkLib/VtkBridge/VtkBridge.hpp"
+
+#include "complex/DataStructure/DataPath.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/DataStructure/Geometry/RectGridGeom.hpp"
+
+#include <vtkCallbackCommand.h>
+#include <vtkCellData.h>
+#include <vtkCommand.h>
+#include <vtkDataArray.h>
+#include <vtkNew.h>
+#include <vtkSmartPointer.h>
+
+#include "TestUtilities.hpp"
+
+using namespace complex;
+
+namespace
+{
+/**
+ * @brief Creates a RectGridGeom with 3 x 2 x 1 cells and non-uniform bounds. The
+ * Z bounds hold zBoundsCount values.
+ * @param dataStructure
+ * @param zBoundsCount
+ * @return std::shared_ptr<RectGridGeom>
+ */
+std::shared_ptr<RectGridGeom> createRectGrid(DataStructure& dataStructure, usize zBoundsCount = 2)
+{
+  auto xBounds = CVTest::CreateArray<float32>(dataStructure, "XBounds", {0.0f, 0.5f, 2.0f, 4.5f});
+  auto yBounds = CVTest::CreateArray<float32>(dataStructure, "YBounds", {-1.0f, 0.0f, 3.0f});
+  auto zBounds = CVTest::CreateArray<float32>(dataStructure, "ZBounds", CVTest::Sequence<float32>(zBoundsCount, 10.0f));
+  auto* rectGrid = RectGridGeom::Create(dataStructure, "RectGrid");
+  rectGrid->setDimensions(SizeVec3(3, 2, 1));
+  rectGrid->setBounds(xBounds.get(), yBounds.get(), zBounds.get());
+  return dataStructure.getSharedDataAs<RectGridGeom>(rectGrid->getId());
+}
+} // namespace
+
+TEST_CASE("CV::RectGridGeom: coordinates are views over the bounds arrays", "[complex2VtkLib][RectGridGeom]")
+{
+  DataStructure dataStructure;
+  auto geom = createRectGrid(dataStructure);
+
+  auto dataSet = CV::RectGridGeom::CreateFromGeom(geom);
+  auto* grid = CV::RectGridGeom::SafeDownCast(dataSet);
+  REQUIRE(grid != nullptr);
+  int dims[3];
+  grid->GetDimensions(dims);
+  REQUIRE(dims[0] == 4);
+  REQUIRE(dims[1] == 3);
+  REQUIRE(dims[2] == 2);
+  REQUIRE(grid->GetNumberOfCells() == 6);
+  REQUIRE(grid->GetNumberOfPoints() == 24);
+
+  auto* xBounds = dynamic_cast<DataStore<float32>*>(geom->getXBounds()->getDataStore());
+  REQUIRE(xBounds != nullptr);
+  REQUIRE(grid->GetXCoordinates()->GetVoidPointer(0) == xBounds->data());
+  REQUIRE(grid->GetXCoordinates()->GetComponent(2, 0) == 2.0);
+  REQUIRE(grid->GetYCoordinates()->GetComponent(0, 0) == -1.0);
+  REQUIRE(grid->GetZCoordinates()->GetComponent(1, 0) == 11.0);
+
+  // The bounds are shared, so changes in complex are seen by VTK.
+  xBounds->setValue(3, 5.0f);
+  REQUIRE(grid->GetXCoordinates()->GetComponent(3, 0) == 5.0);
+  double point[3];
+  grid->GetPoint(23, point);
+  REQUIRE(point[0] == 5.0);
+  REQUIRE(point[1] == 3.0);
+  REQUIRE(point[2] == 11.0);
+}
+
+TEST_CASE("CV::RectGridGeom: mismatched bounds leave the grid empty", "[complex2VtkLib][RectGridGeom]")
+{
+  DataStructure dataStructure;
+  auto geom = createRectGrid(dataStructure, 3);
+
+  vtkSmartPointer<CV::RectGridGeom> grid;
+  grid.TakeReference(CV::RectGridGeom::New());
+  int numErrors = 0;
+  vtkNew<vtkCallbackCommand> errorObserver;
+  errorObserver->SetClientData(&numErrors);
+  errorObserver->SetCallback([](vtkObject*, unsigned long, void* clientData, void*) { (*static_cast<int*>(clientData))++; });
+  grid->AddObserver(vtkCommand::ErrorEvent, errorObserver);
+
+  grid->SetGeometry(geom);
+  REQUIRE(numErrors == 1);
+  REQUIRE(grid->GetNumberOfCells() == 0);
+  REQUIRE(grid->GetNumberOfPoints() == 0);
+}
+
+TEST_CASE("CV::RectGridGeom: linked cell arrays are wrapped", "[complex2VtkLib][RectGridGeom]")
+{
+  DataStructure dataStructure;
+  auto geom = createRectGrid(dataStructure);
+  CVTest::CreateArray<int32>(dataStructure, "Phases", {1, 2, 2, 1, 3, 3});
+  geom->getLinkedGeometryData().addCellData(DataPath({"Phases"}));
+
+  auto dataSet = CV::VtkBridge::wrapGeometryWithArrays(geom);
+  REQUIRE(CV::RectGridGeom::SafeDownCast(dataSet) != nullptr);
+  vtkDataArray* phases = dataSet->GetCellData()->GetArray("Phases");
+  REQUIRE(phases != nullptr);
+  REQUIRE(phases->GetNumberOfTuples() == 6);
+  REQUIRE(phases->GetComponent(4, 0) == 3.0);
+  REQUIRE(dataSet->GetCellData()->GetScalars() == phases);
+}
@@ -0,0 +1,140 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVComponentView.hpp"
+#include "complex2VtkLib/VtkBridge/CVFeatureGatherArray.hpp"
+#include "complex2VtkLib/VtkBridge/CVRunLengthDataStore.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+
+#include <vtkSmartPointer.h>
+
+#include "TestUtilities.hpp"
+
+using namespace complex;
+
+namespace
+{
+constexpr usize k_NumValues = 3 * CV::RunLengthDataStore<int32>::k_BlockSize + 17;
+
+/**
+ * @brief Returns labels with runs of 1000 equal values.
+ * @return std::vector<int32>
+ */
+std::vector<int32> createLabels()
+{
+  std::vector<int32> labels(k_NumValues);
+  for(usize idx = 0; idx < k_NumValues; idx++)
+  {
+    labels[idx] = static_cast<int32>(idx / 1000);
+  }
+  return labels;
+}
+} // namespace
+
+TEST_CASE("CV::RunLengthDataStore: references stay valid across reads", "[complex2VtkLib][RunLengthDataStore]")
+{
+  DataStructure dataStructure;
+  const auto labels = createLabels();
+  auto dataArray = CVTest::CreateArray<int32>(dataStructure, "Labels", labels);
+  CV::CompressDataArray(*dataArray);
+  auto* store = dynamic_cast<CV::RunLengthDataStore<int32>*>(dataArray->getDataStore());
+  REQUIRE(store != nullptr);
+  REQUIRE(store->getStoreType() == IDataStore::StoreType::OutOfCore);
+  REQUIRE(store->getNumberOfExpandedBlocks() == 0);
+
+  const auto& constStore = *store;
+  const int32& first = constStore[10];
+  const int32& last = constStore[k_NumValues - 1];
+  REQUIRE(first == 0);
+  REQUIRE(last == labels.back());
+  REQUIRE(store->getValue(5000) == 5);
+  REQUIRE(first == 0);
+
+  (*store)[20] = 42;
+  store->at(k_NumValues - 2) = 43;
+  REQUIRE(store->getValue(20) == 42);
+  REQUIRE(store->getValue(k_NumValues - 2) == 43);
+  REQUIRE(store->getNumberOfExpandedBlocks() == 2);
+
+  store->setValue(21, 44);
+  REQUIRE(constStore[21] == 44);
+
+  std::vector<int32> copied(k_NumValues);
+  store->copyValues(0, k_NumValues, copied.data());
+  REQUIRE(copied[20] == 42);
+  REQUIRE(copied[4500] == 4);
+
+  auto copy = store->deepCopy();
+  auto* copiedStore = dynamic_cast<CV::RunLengthDataStore<int32>*>(copy.get());
+  REQUIRE(copiedStore->getNumberOfExpandedBlocks() == 0);
+  REQUIRE(copiedStore->getValue(21) == 44);
+
+  store->compact();
+  REQUIRE(store->getNumberOfExpandedBlocks() == 0);
+  REQUIRE(store->getValue(20) == 42);
+  REQUIRE(store->getValue(k_NumValues - 2) == 43);
+}
+
+TEST_CASE("CV::RunLengthDataStore: scattered and sequential reads agree", "[complex2VtkLib][RunLengthDataStore]")
+{
+  // Runs of 1 to 7 values, so single reads land at the start, middle and end of runs
+  std::vector<int32> values(k_NumValues);
+  for(usize idx = 0; idx < k_NumValues; idx++)
+  {
+    values[idx] = static_cast<int32>(idx / (1 + idx % 7));
+  }
+  DataStructure dataStructure;
+  auto dataArray = CVTest::CreateArray<int32>(dataStructure, "Values", values);
+  CV::CompressDataArray(*dataArray);
+  auto* store = dynamic_cast<CV::RunLengthDataStore<int32>*>(dataArray->getDataStore());
+  REQUIRE(store != nullptr);
+
+  // Jump between blocks so every read is a single-value lookup
+  constexpr usize k_BlockSize = CV::RunLengthDataStore<int32>::k_BlockSize;
+  for(usize offset = 0; offset < k_BlockSize; offset += 97)
+  {
+    for(usize blockStart = 0; blockStart + offset < k_NumValues; blockStart += k_BlockSize)
+    {
+      REQUIRE(store->getValue(blockStart + offset) == values[blockStart + offset]);
+    }
+  }
+  REQUIRE(store->getValue(k_NumValues - 1) == values.back());
+  REQUIRE(store->getValue(0) == values.front());
+
+  for(usize idx = 0; idx < k_NumValues; idx++)
+  {
+    REQUIRE(store->getValue(idx) == values[idx]);
+  }
+  store->setValue(k_BlockSize + 1, -5);
+  REQUIRE(store->getValue(k_BlockSize + 1) == -5);
+  REQUIRE(store->getValue(k_BlockSize + 2) == values[k_BlockSize + 2]);
+  REQUIRE(store->getNumberOfExpandedBlocks() == 0);
+}
+
+TEST_CASE("CV::RunLengthDataStore: compressed arrays can be viewed and gathered", "[complex2VtkLib][RunLengthDataStore]")
+{
+  DataStructure dataStructure;
+  auto vectors = CVTest::CreateArray<int32>(dataStructure, "Vectors", CVTest::Sequence<int32>(3 * k_NumValues), 3);
+  CV::CompressDataArray(*vectors);
+
+  vtkSmartPointer<CV::ComponentView<int32>> view;
+  view.TakeReference(CV::ComponentView<int32>::New());
+  view->SetComplexArray(vectors, 2);
+  REQUIRE(view->GetNumberOfTuples() == static_cast<vtkIdType>(k_NumValues));
+  REQUIRE(view->GetValue(0) == 2);
+  REQUIRE(view->GetValue(5000) == 15002);
+  view->SetValue(1, -1);
+  REQUIRE(vectors->getDataStore()->getValue(5) == -1);
+
+  auto featureIds = CVTest::CreateArray<int32>(dataStructure, "FeatureIds", createLabels());
+  CV::CompressDataArray(*featureIds);
+  auto featureArray = CVTest::CreateArray<float>(dataStructure, "Volumes", CVTest::Sequence<float>(k_NumValues / 1000 + 1, 0.0f, 0.5f));
+  CV::CompressDataArray(*featureArray);
+
+  vtkSmartPointer<CV::FeatureGatherArray<float>> gatherArray;
+  gatherArray.TakeReference(new CV::FeatureGatherArray<float>(featureIds, featureArray));
+  REQUIRE(gatherArray->HasValidFeatureIds());
+  REQUIRE(gatherArray->GetValue(0) == 0.0f);
+  REQUIRE(gatherArray->GetValue(4500) == 2.0f);
+  REQUIRE(gatherArray->GetValue(k_NumValues - 1) == 0.5f * static_cast<float>((k_NumValues - 1) / 1000));
+}
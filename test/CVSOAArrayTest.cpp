@@ -0,0 +1,82 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVSOAArray.hpp"
+#include "complex2VtkLib/VtkBridge/VtkBridge.hpp"
+
+#include "complex/DataStructure/DataStructure.hpp"
+
+#include <vtkDataArray.h>
+#include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkSmartPointer.h>
+
+#include "TestUtilities.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace complex;
+
+TEST_CASE("CV::SOAArray: separate coordinate arrays become vtkPoints data", "[complex2VtkLib][SOAArray]")
+{
+  DataStructure dataStructure;
+  auto xCoords = CVTest::CreateArray<float32>(dataStructure, "X", {0.0f, 1.0f, 2.0f, 3.0f});
+  auto yCoords = CVTest::CreateArray<float32>(dataStructure, "Y", {10.0f, 11.0f, 12.0f, 13.0f});
+  auto zCoords = CVTest::CreateArray<float32>(dataStructure, "Z", {-1.0f, -2.0f, -3.0f, -4.0f});
+
+  vtkSmartPointer<vtkDataArray> wrapped;
+  wrapped.TakeReference(CV::VtkBridge::wrapDataArrays(dataStructure, {xCoords->getId(), yCoords->getId(), zCoords->getId()}));
+  auto* soaArray = CV::SOAArray<float32>::SafeDownCast(wrapped);
+  REQUIRE(soaArray != nullptr);
+  REQUIRE(std::string(soaArray->GetName()) == "X_Y_Z");
+  REQUIRE(soaArray->GetNumberOfTuples() == 4);
+  REQUIRE(soaArray->GetNumberOfComponents() == 3);
+  REQUIRE(soaArray->GetValue(7) == 11.0f);
+
+  vtkNew<vtkPoints> points;
+  points->SetData(soaArray);
+  REQUIRE(points->GetNumberOfPoints() == 4);
+  double point[3];
+  points->GetPoint(2, point);
+  REQUIRE(point[0] == 2.0);
+  REQUIRE(point[1] == 12.0);
+  REQUIRE(point[2] == -3.0);
+  double bounds[6];
+  points->GetBounds(bounds);
+  REQUIRE(bounds[0] == 0.0);
+  REQUIRE(bounds[3] == 13.0);
+  REQUIRE(bounds[4] == -4.0);
+
+  // Writes go to the component's complex array.
+  float32 tuple[3] = {5.0f, 6.0f, 7.0f};
+  soaArray->SetTypedTuple(1, tuple);
+  REQUIRE((*xCoords)[1] == 5.0f);
+  REQUIRE((*yCoords)[1] == 6.0f);
+  REQUIRE((*zCoords)[1] == 7.0f);
+  soaArray->SetTypedComponent(3, 2, 0.5f);
+  REQUIRE((*zCoords)[3] == 0.5f);
+}
+
+TEST_CASE("CV::VtkBridge: wrapDataArrays rejects arrays that do not match", "[complex2VtkLib][SOAArray]")
+{
+  DataStructure dataStructure;
+  auto xCoords = CVTest::CreateArray<float32>(dataStructure, "X", {0.0f, 1.0f, 2.0f});
+  auto yCoords = CVTest::CreateArray<float32>(dataStructure, "Y", {0.0f, 1.0f, 2.0f});
+  auto doubleCoords = CVTest::CreateArray<float64>(dataStructure, "Double", {0.0, 1.0, 2.0});
+  auto shortCoords = CVTest::CreateArray<float32>(dataStructure, "Short", {0.0f, 1.0f});
+  auto vectors = CVTest::CreateArray<float32>(dataStructure, "Vectors", CVTest::Sequence<float32>(6), 2);
+
+  const std::vector<std::vector<DataObject::IdType>> rejected = {
+      {},
+      {xCoords->getId(), yCoords->getId(), doubleCoords->getId()},
+      {doubleCoords->getId(), xCoords->getId()},
+      {xCoords->getId(), shortCoords->getId(), yCoords->getId()},
+      {xCoords->getId(), vectors->getId()},
+  };
+  for(const auto& arrayIds : rejected)
+  {
+    vtkSmartPointer<vtkDataArray> wrapped;
+    wrapped.TakeReference(CV::VtkBridge::wrapDataArrays(dataStructure, arrayIds));
+    REQUIRE(wrapped == nullptr);
+  }
+}
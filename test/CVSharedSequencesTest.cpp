@@ -0,0 +1,50 @@
+#include <catch2/catch.hpp>
+
+#include "complex2VtkLib/VtkBridge/CVSharedSequences.hpp"
+
+#include <vtkCellType.h>
+
+TEST_CASE("CV::SharedSequences: arrays alias one buffer per step", "[complex2VtkLib][SharedSequences]")
+{
+  CV::SharedSequences::Clear();
+  {
+    auto first = CV::SharedSequences::GetOffsets(10, 3);
+    auto second = CV::SharedSequences::GetOffsets(5, 3);
+    REQUIRE(first->GetNumberOfValues() == 11);
+    REQUIRE(second->GetNumberOfValues() == 6);
+    REQUIRE(first->GetPointer(0) == second->GetPointer(0));
+    REQUIRE(second->GetValue(5) == 15);
+    REQUIRE(CV::SharedSequences::GetCachedBytes() == 11 * sizeof(vtkTypeInt64));
+
+    // A larger mesh grows the buffer. Earlier arrays keep the smaller one.
+    auto third = CV::SharedSequences::GetOffsets(100, 3);
+    REQUIRE(third->GetValue(100) == 300);
+    REQUIRE(first->GetValue(10) == 30);
+    REQUIRE(first->GetPointer(0) != third->GetPointer(0));
+    // The cached buffer now holds exactly the larger mesh, not twice the old one.
+    REQUIRE(CV::SharedSequences::GetCachedBytes() == 101 * sizeof(vtkTypeInt64));
+
+    auto cellTypes = CV::SharedSequences::GetCellTypes(4, VTK_TETRA);
+    REQUIRE(cellTypes->GetValue(3) == VTK_TETRA);
+  }
+
+  // The cache does not keep buffers alive.
+  REQUIRE(CV::SharedSequences::GetCachedBytes() == 0);
+}
+
+TEST_CASE("CV::SharedSequences: writes do not reach other meshes", "[complex2VtkLib][SharedSequences]")
+{
+  auto first = CV::SharedSequences::GetOffsets(10, 4);
+  auto second = CV::SharedSequences::GetOffsets(10, 4);
+
+  second->SetComponent(1, 0, -1.0);
+  REQUIRE(second->GetValue(1) == -1);
+  REQUIRE(first->GetValue(1) == 4);
+  REQUIRE(first->GetPointer(0) != second->GetPointer(0));
+
+  auto cellTypes = CV::SharedSequences::GetCellTypes(4, VTK_HEXAHEDRON);
+  auto otherCellTypes = CV::SharedSequences::GetCellTypes(4, VTK_HEXAHEDRON);
+  otherCellTypes->Fill(VTK_TETRA);
+  REQUIRE(otherCellTypes->GetValue(0) == VTK_TETRA);
+  REQUIRE(cellTypes->GetValue(0) == VTK_HEXAHEDRON);
+}
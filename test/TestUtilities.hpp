@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+
+namespace CVTest
+{
+/**
+ * @brief Creates a DataArray<T> backed by a contiguous complex::DataStore<T> that
+ * holds values in AOS order with numComps components per tuple.
+ * @tparam T
+ * @param dataStructure
+ * @param name
+ * @param values
+ * @param numComps
+ * @return std::shared_ptr<complex::DataArray<T>>
+ */
+template <class T>
+std::shared_ptr<complex::DataArray<T>> CreateArray(complex::DataStructure& dataStructure, const std::string& name, const std::vector<T>& values, size_t numComps = 1)
+{
+  const std::vector<size_t> tupleShape = {values.size() / numComps};
+  const std::vector<size_t> componentShape = {numComps};
+  auto* dataArray = complex::DataArray<T>::template CreateWithStore<complex::DataStore<T>>(dataStructure, name, tupleShape, componentShape);
+  auto* dataStore = dataArray->getDataStore();
+  for(size_t idx = 0; idx < values.size(); idx++)
+  {
+    dataStore->setValue(idx, values[idx]);
+  }
+  return dataStructure.getSharedDataAs<complex::DataArray<T>>(dataArray->getId());
+}
+
+/**
+ * @brief Returns the numValues values first, first + step, first + 2 * step, ...
+ * @tparam T
+ * @param numValues
+ * @param first
+ * @param step
+ * @return std::vector<T>
+ */
+template <class T>
+std::vector<T> Sequence(size_t numValues, T first = T(0), T step = T(1))
+{
+  std::vector<T> values(numValues);
+  for(size_t idx = 0; idx < numValues; idx++)
+  {
+    values[idx] = static_cast<T>(first + static_cast<T>(idx) * step);
+  }
+  return values;
+}
+} // namespace CVTest